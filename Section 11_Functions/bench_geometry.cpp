@@ -0,0 +1,108 @@
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "benchmark.h"
+#include "geometry.h"
+
+/**
+ * range(0) parts with radii and heights of 0 to 10, the areas and volumes written to a second array.
+ * The one part functions are the ones of main.cpp, called once per part: in the same file the compiler
+ * inlines and vectorizes the loop anyway, the _call versions go through a pointer like a call to another file.
+ */
+namespace {
+    double area_circle(double radius) {
+        return geometry::pi * pow(radius, 2);
+    }
+
+    double volume_cylinder(double height, double radius) { return height * area_circle(radius); }
+
+    std::vector<double> sizes(std::size_t n, std::uint64_t seed) {
+        std::vector<double> values(n);
+        std::uint64_t state{seed};
+        for (auto& value: values) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            value = static_cast<double>(state >> 11) * 0x1.0p-53 * 10.0;
+        }
+        return values;
+    }
+}
+
+void bm_area_scalar(bench::State& state) {
+    const auto radii = sizes(state.range(0), 42);
+    std::vector<double> areas(radii.size());
+    while (state.keep_running()) {
+        for (std::size_t i{0}; i < radii.size(); i++)
+            areas[i] = area_circle(radii[i]);
+        bench::do_not_optimize(areas.data());
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+}
+BENCHMARK(bm_area_scalar)->arg(1'000)->arg(10'000'000);
+
+void bm_area_call(bench::State& state) {
+    const auto radii = sizes(state.range(0), 42);
+    std::vector<double> areas(radii.size());
+    double (* volatile area)(double){area_circle};
+    while (state.keep_running()) {
+        for (std::size_t i{0}; i < radii.size(); i++)
+            areas[i] = area(radii[i]);
+        bench::do_not_optimize(areas.data());
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+}
+BENCHMARK(bm_area_call)->arg(1'000)->arg(10'000'000);
+
+void bm_area_span(bench::State& state) {
+    const auto radii = sizes(state.range(0), 42);
+    std::vector<double> areas(radii.size());
+    const auto threads = static_cast<unsigned>(state.range(1));
+    while (state.keep_running()) {
+        geometry::area_circle(radii, areas, threads);
+        bench::do_not_optimize(areas.data());
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+}
+BENCHMARK(bm_area_span)->args({1'000, 1})->args({10'000'000, 1})->args({10'000'000, 4});
+
+void bm_volume_scalar(bench::State& state) {
+    const auto heights = sizes(state.range(0), 7);
+    const auto radii = sizes(state.range(0), 42);
+    std::vector<double> volumes(radii.size());
+    while (state.keep_running()) {
+        for (std::size_t i{0}; i < radii.size(); i++)
+            volumes[i] = volume_cylinder(heights[i], radii[i]);
+        bench::do_not_optimize(volumes.data());
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+}
+BENCHMARK(bm_volume_scalar)->arg(1'000)->arg(10'000'000);
+
+void bm_volume_call(bench::State& state) {
+    const auto heights = sizes(state.range(0), 7);
+    const auto radii = sizes(state.range(0), 42);
+    std::vector<double> volumes(radii.size());
+    double (* volatile volume)(double, double){volume_cylinder};
+    while (state.keep_running()) {
+        for (std::size_t i{0}; i < radii.size(); i++)
+            volumes[i] = volume(heights[i], radii[i]);
+        bench::do_not_optimize(volumes.data());
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+}
+BENCHMARK(bm_volume_call)->arg(1'000)->arg(10'000'000);
+
+void bm_volume_span(bench::State& state) {
+    const auto heights = sizes(state.range(0), 7);
+    const auto radii = sizes(state.range(0), 42);
+    std::vector<double> volumes(radii.size());
+    const auto threads = static_cast<unsigned>(state.range(1));
+    while (state.keep_running()) {
+        geometry::volume_cylinder(heights, radii, volumes, threads);
+        bench::do_not_optimize(volumes.data());
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+}
+BENCHMARK(bm_volume_span)->args({1'000, 1})->args({10'000'000, 1})->args({10'000'000, 4});
@@ -0,0 +1,139 @@
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "benchmark.h"
+#include "rng.h"
+
+/**
+ * Numbers per second: raw 64/32-bit numbers, dice rolls (1 to 6) and arrays of 1M dice.
+ * A block of 1M numbers per iteration, summed so none of them can be skipped.
+ */
+namespace {
+    constexpr std::size_t block{1 << 20};
+
+    template<typename G>
+    void raw_numbers(bench::State& state, G generator) {
+        while (state.keep_running()) {
+            std::uint64_t sum{0};
+            for (std::size_t i{0}; i < block; i++)
+                sum += generator();
+            bench::do_not_optimize(sum);
+        }
+        state.set_items_processed(state.iterations() * static_cast<std::int64_t>(block));
+    }
+}
+
+void bm_raw_rand(bench::State& state) {
+    std::srand(42);
+    while (state.keep_running()) {
+        std::uint64_t sum{0};
+        for (std::size_t i{0}; i < block; i++)
+            sum += static_cast<std::uint64_t>(std::rand());
+        bench::do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * static_cast<std::int64_t>(block));
+}
+BENCHMARK(bm_raw_rand);
+
+void bm_raw_mt19937(bench::State& state) { raw_numbers(state, std::mt19937{42}); }
+BENCHMARK(bm_raw_mt19937);
+
+void bm_raw_mt19937_64(bench::State& state) { raw_numbers(state, std::mt19937_64{42}); }
+BENCHMARK(bm_raw_mt19937_64);
+
+void bm_raw_splitmix(bench::State& state) { raw_numbers(state, rng::SplitMix64{42}); }
+BENCHMARK(bm_raw_splitmix);
+
+void bm_raw_xoshiro(bench::State& state) { raw_numbers(state, rng::Xoshiro256StarStar{42}); }
+BENCHMARK(bm_raw_xoshiro);
+
+void bm_raw_pcg(bench::State& state) { raw_numbers(state, rng::Pcg32{42}); }
+BENCHMARK(bm_raw_pcg);
+
+void bm_dice_rand(bench::State& state) {
+    // the Section 11 loop: rand() % max + min
+    std::srand(42);
+    while (state.keep_running()) {
+        std::uint64_t sum{0};
+        for (std::size_t i{0}; i < block; i++)
+            sum += static_cast<std::uint64_t>(std::rand() % 6 + 1);
+        bench::do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * static_cast<std::int64_t>(block));
+}
+BENCHMARK(bm_dice_rand);
+
+void bm_dice_mt19937(bench::State& state) {
+    std::mt19937 generator{42};
+    std::uniform_int_distribution<int> dice{1, 6};
+    while (state.keep_running()) {
+        std::uint64_t sum{0};
+        for (std::size_t i{0}; i < block; i++)
+            sum += static_cast<std::uint64_t>(dice(generator));
+        bench::do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * static_cast<std::int64_t>(block));
+}
+BENCHMARK(bm_dice_mt19937);
+
+void bm_dice_xoshiro(bench::State& state) {
+    rng::Xoshiro256StarStar generator{42};
+    while (state.keep_running()) {
+        std::uint64_t sum{0};
+        for (std::size_t i{0}; i < block; i++)
+            sum += static_cast<std::uint64_t>(rng::uniform_int(generator, 1, 6));
+        bench::do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * static_cast<std::int64_t>(block));
+}
+BENCHMARK(bm_dice_xoshiro);
+
+void bm_dice_pcg(bench::State& state) {
+    rng::Pcg32 generator{42};
+    while (state.keep_running()) {
+        std::uint64_t sum{0};
+        for (std::size_t i{0}; i < block; i++)
+            sum += static_cast<std::uint64_t>(rng::uniform_int(generator, 1, 6));
+        bench::do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * static_cast<std::int64_t>(block));
+}
+BENCHMARK(bm_dice_pcg);
+
+void bm_fill_dice(bench::State& state) {
+    // range(0) threads fill their part of 1M dice each with their own stream
+    const auto threads = static_cast<std::size_t>(state.range(0));
+    auto streams = rng::make_streams(42, threads);
+    std::vector<int> dice(block);
+    const std::size_t part = block / threads;
+    while (state.keep_running()) {
+        if (threads == 1) {
+            rng::fill_uniform(streams[0], std::span{dice}, 1, 6);
+        } else {
+            std::vector<std::thread> workers;
+            for (std::size_t t{0}; t < threads; t++)
+                workers.emplace_back([&streams, &dice, t, part] {
+                    rng::fill_uniform(streams[t], std::span{dice}.subspan(t * part, part), 1, 6);
+                });
+            for (auto& worker: workers)
+                worker.join();
+        }
+        bench::do_not_optimize(dice.data());
+    }
+    state.set_items_processed(state.iterations() * static_cast<std::int64_t>(block));
+}
+BENCHMARK(bm_fill_dice)->arg(1)->arg(4);
+
+void bm_fill_canonical(bench::State& state) {
+    rng::Xoshiro256StarStar generator{42};
+    std::vector<double> values(block);
+    while (state.keep_running()) {
+        rng::fill_canonical(generator, std::span{values});
+        bench::do_not_optimize(values.data());
+    }
+    state.set_items_processed(state.iterations() * static_cast<std::int64_t>(block));
+}
+BENCHMARK(bm_fill_canonical);
@@ -0,0 +1,46 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "geometry.h"
+
+#include <stdexcept>
+
+#include "parallel.h"
+
+namespace geometry {
+    namespace {
+        // parts of 8 values (64 bytes), threads do not share the cache lines of aligned arrays
+        constexpr std::size_t part_granularity{8};
+
+        void areas_of(const double* radii, double* areas, std::size_t n) {
+            for (std::size_t i{0}; i < n; i++)
+                areas[i] = pi * (radii[i] * radii[i]);
+        }
+
+        void volumes_of(const double* heights, const double* radii, double* volumes, std::size_t n) {
+            for (std::size_t i{0}; i < n; i++)
+                volumes[i] = heights[i] * (pi * (radii[i] * radii[i]));
+        }
+
+    }
+
+    void area_circle(std::span<const double> radii, std::span<double> areas, unsigned threads) {
+        if (areas.size() != radii.size())
+            throw std::invalid_argument{"geometry::area_circle: needs one area per radius"};
+        const auto parts = parallel::threads_for(radii.size(), threads, parallel_threshold);
+        parallel::split(radii.size(), parts, [&](unsigned, std::size_t first, std::size_t last) {
+            areas_of(radii.data() + first, areas.data() + first, last - first);
+        }, part_granularity);
+    }
+
+    void volume_cylinder(std::span<const double> heights, std::span<const double> radii, std::span<double> volumes,
+                         unsigned threads) {
+        if (radii.size() != heights.size() || volumes.size() != heights.size())
+            throw std::invalid_argument{"geometry::volume_cylinder: needs one radius and one volume per height"};
+        const auto parts = parallel::threads_for(heights.size(), threads, parallel_threshold);
+        parallel::split(heights.size(), parts, [&](unsigned, std::size_t first, std::size_t last) {
+            volumes_of(heights.data() + first, radii.data() + first, volumes.data() + first, last - first);
+        }, part_granularity);
+    }
+}
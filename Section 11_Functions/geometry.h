@@ -0,0 +1,37 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_11_FUNCTIONS_GEOMETRY_H
+#define SECTION_11_FUNCTIONS_GEOMETRY_H
+
+#include <cstddef>
+#include <span>
+
+/**
+ * area_circle and volume_cylinder of Section 11 for whole arrays of parts.
+ *
+ * The loops have no calls and no branches, so the compiler turns them into SIMD code (-O3, the Release build);
+ * every result is the same double the one part functions compute.
+ */
+namespace geometry {
+    constexpr double pi{3.14159};
+
+    /**
+     * Arrays from this size on are split between threads with threads = 0
+     */
+    constexpr std::size_t parallel_threshold{1 << 18};
+
+    /**
+     * areas[i] = pi * radii[i]^2, std::invalid_argument if the sizes differ
+     */
+    void area_circle(std::span<const double> radii, std::span<double> areas, unsigned threads = 0);
+
+    /**
+     * volumes[i] = heights[i] * pi * radii[i]^2, std::invalid_argument if the sizes differ
+     */
+    void volume_cylinder(std::span<const double> heights, std::span<const double> radii, std::span<double> volumes,
+                         unsigned threads = 0);
+}
+
+#endif //SECTION_11_FUNCTIONS_GEOMETRY_H
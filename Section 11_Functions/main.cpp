@@ -1,9 +1,11 @@
 #include <iostream>
 #include <cmath>
-#include <cstdlib> // required for rand()
 #include <ctime>    // required for time()
 #include <vector>
 
+#include "geometry.h"
+#include "rng.h"
+
 using namespace std;
 
 double volume_cylinder(double height, double radius); // prototype with parameters names and types
@@ -18,7 +20,7 @@ void zero_vector_reference(std::vector<int> &v);
 void one_vector_value(std::vector<int> v);
 
 
-const double pi{3.14159};
+const double pi{geometry::pi};
 
 
 void area_circle() {
@@ -79,11 +81,11 @@ int main() {
 
     // seed the random number generator
     // if you don't seed the generator, you will get the same sequence of random number every run
-    cout << "RAND_MAX on my system is: " << RAND_MAX << endl;
-    srand(time(nullptr));
+    // rand() % max + min favours the small numbers and shares its state with every thread, rng::uniform_int does neither
+    rng::Xoshiro256StarStar generator{static_cast<std::uint64_t>(time(nullptr))};
 
     for (size_t i{0}; i < count; i++) {
-        random_numbers = rand() % max + min; // generate random number [min, max]
+        random_numbers = rng::uniform_int(generator, min, max); // generate random number [min, max]
         cout << random_numbers << "\t";
     }
 
@@ -115,6 +117,17 @@ int main() {
     area_circle();
     volume_cylinder();
 
+    // a whole batch of parts per call, the same formulas as area_circle(double) and volume_cylinder(double, double)
+    const vector<double> radii{1.0, 2.5, 4.0, 10.0};
+    const vector<double> heights{2.0, 2.0, 0.5, 1.0};
+    vector<double> areas(radii.size()), volumes(radii.size());
+    geometry::area_circle(radii, areas);
+    geometry::volume_cylinder(heights, radii, volumes);
+    for (size_t i{0}; i < radii.size(); i++)
+        cout << "radius " << radii[i] << ": area " << areas[i] << " (" << area_circle(radii[i]) << "), volume "
+             << volumes[i] << " (" << volume_cylinder(heights[i], radii[i]) << ")" << endl;
+    cout << endl;
+
 
     cout << "No default Values" << calc_cost(100.0, 0.08, 4.25) << endl;
     cout << "Default Shipping" << calc_cost(100, 0.08) << endl;
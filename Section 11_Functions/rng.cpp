@@ -0,0 +1,76 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "rng.h"
+
+namespace rng {
+    Xoshiro256StarStar::Xoshiro256StarStar(std::uint64_t seed) {
+        SplitMix64 seeder{seed};
+        for (auto& word: state_)
+            word = seeder();
+    }
+
+    void Xoshiro256StarStar::jump() {
+        static constexpr std::uint64_t polynomial[4]{
+                0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c};
+        jump(polynomial);
+    }
+
+    void Xoshiro256StarStar::long_jump() {
+        static constexpr std::uint64_t polynomial[4]{
+                0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635};
+        jump(polynomial);
+    }
+
+    void Xoshiro256StarStar::jump(const std::uint64_t (&polynomial)[4]) {
+        // the state after 2^128 (2^192) steps, as the sum of the states at the bits of the jump polynomial
+        std::uint64_t jumped[4]{};
+        for (const std::uint64_t word: polynomial) {
+            for (int bit{0}; bit < 64; bit++) {
+                if (word & std::uint64_t{1} << bit) {
+                    for (int i{0}; i < 4; i++)
+                        jumped[i] ^= state_[i];
+                }
+                (*this)();
+            }
+        }
+        for (int i{0}; i < 4; i++)
+            state_[i] = jumped[i];
+    }
+
+    Pcg32::Pcg32(std::uint64_t seed, std::uint64_t stream) : increment_{stream << 1 | 1} {
+        (*this)();
+        state_ += seed;
+        (*this)();
+    }
+
+    void Pcg32::advance(std::uint64_t n) {
+        // n steps of state = state * a + c at once, by squaring the step (Brown, "Random number generation with arbitrary strides")
+        std::uint64_t total_multiplier{1};
+        std::uint64_t total_increment{0};
+        std::uint64_t step_multiplier{multiplier};
+        std::uint64_t step_increment{increment_};
+        while (n > 0) {
+            if (n & 1) {
+                total_multiplier *= step_multiplier;
+                total_increment = total_increment * step_multiplier + step_increment;
+            }
+            step_increment = (step_multiplier + 1) * step_increment;
+            step_multiplier *= step_multiplier;
+            n >>= 1;
+        }
+        state_ = total_multiplier * state_ + total_increment;
+    }
+
+    std::vector<Xoshiro256StarStar> make_streams(std::uint64_t seed, std::size_t count) {
+        std::vector<Xoshiro256StarStar> streams;
+        streams.reserve(count);
+        Xoshiro256StarStar generator{seed};
+        for (std::size_t i{0}; i < count; i++) {
+            streams.push_back(generator);
+            generator.jump();
+        }
+        return streams;
+    }
+}
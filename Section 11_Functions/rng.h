@@ -0,0 +1,236 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_11_FUNCTIONS_RNG_H
+#define SECTION_11_FUNCTIONS_RNG_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Random numbers without rand().
+ *
+ * rand() % max + min favours the small values (RAND_MAX + 1 is rarely a multiple of max), shares one hidden state
+ * between all threads and is slow. The generators below are small values with their own state: give every thread
+ * its own one (make_streams), draw bounded numbers with uniform_int (Lemire's method, no bias) and fill whole arrays
+ * with fill / fill_uniform / fill_canonical.
+ *
+ * All of them are UniformRandomBitGenerators, the <random> distributions accept them too.
+ */
+namespace rng {
+    /**
+     * SplitMix64 (Steele, Lea and Flood): one 64-bit add per number, used to seed the other generators
+     */
+    class SplitMix64 {
+    public:
+        using result_type = std::uint64_t;
+
+        explicit SplitMix64(std::uint64_t seed = 0) : state_{seed} {}
+
+        static constexpr result_type min() { return 0; }
+
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()() {
+            std::uint64_t z = (state_ += 0x9e3779b97f4a7c15);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+            return z ^ (z >> 31);
+        }
+
+    private:
+        std::uint64_t state_;
+    };
+
+    /**
+     * xoshiro256** (Blackman and Vigna): 256 bits of state, period 2^256 - 1.
+     * jump() moves 2^128 numbers ahead, so streams made by jumping never overlap
+     */
+    class Xoshiro256StarStar {
+    public:
+        using result_type = std::uint64_t;
+
+        /**
+         * The state is 4 outputs of SplitMix64 seeded with seed, never all zero
+         */
+        explicit Xoshiro256StarStar(std::uint64_t seed = 0);
+
+        static constexpr result_type min() { return 0; }
+
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()() {
+            const std::uint64_t result = std::rotl(state_[1] * 5, 7) * 9;
+            const std::uint64_t t = state_[1] << 17;
+            state_[2] ^= state_[0];
+            state_[3] ^= state_[1];
+            state_[1] ^= state_[2];
+            state_[0] ^= state_[3];
+            state_[2] ^= t;
+            state_[3] = std::rotl(state_[3], 45);
+            return result;
+        }
+
+        /**
+         * As 2^128 calls, for 2^128 streams
+         */
+        void jump();
+
+        /**
+         * As 2^192 calls, for 2^64 groups of 2^64 jump() streams
+         */
+        void long_jump();
+
+    private:
+        void jump(const std::uint64_t (&polynomial)[4]);
+
+        std::uint64_t state_[4];
+    };
+
+    /**
+     * PCG32 (O'Neill), XSH RR: 64-bit LCG state, 32-bit output, 2^63 streams chosen by stream.
+     * advance(n) skips n numbers in log2(n) steps
+     */
+    class Pcg32 {
+    public:
+        using result_type = std::uint32_t;
+
+        explicit Pcg32(std::uint64_t seed = 0x853c49e6748fea9b, std::uint64_t stream = 0xda3e39cb94b95bdb);
+
+        static constexpr result_type min() { return 0; }
+
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()() {
+            const std::uint64_t old = state_;
+            state_ = old * multiplier + increment_;
+            const auto shifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+            return std::rotr(shifted, static_cast<int>(old >> 59));
+        }
+
+        void advance(std::uint64_t n);
+
+    private:
+        static constexpr std::uint64_t multiplier{6364136223846793005};
+
+        std::uint64_t state_{0};
+        std::uint64_t increment_;
+    };
+
+    /**
+     * count generators for count threads: the first one seeded with seed, every next one a jump() further
+     */
+    std::vector<Xoshiro256StarStar> make_streams(std::uint64_t seed, std::size_t count);
+
+    /**
+     * 32 random bits, the high half of a 64-bit generator
+     */
+    template<typename G>
+    std::uint32_t next32(G& generator) {
+        if constexpr (sizeof(typename G::result_type) > 4)
+            return static_cast<std::uint32_t>(generator() >> 32);
+        else
+            return static_cast<std::uint32_t>(generator());
+    }
+
+    template<typename G>
+    std::uint64_t next64(G& generator) {
+        if constexpr (sizeof(typename G::result_type) > 4) {
+            return generator();
+        } else {
+            const std::uint64_t high = generator();
+            return high << 32 | generator();
+        }
+    }
+
+    /**
+     * Uniform in [0, range), range above 0. Lemire's nearly divisionless method: one multiplication,
+     * a division only in range / 2^32 of the calls, a new number only for the few that would bias the result
+     */
+    template<typename G>
+    std::uint32_t bounded(G& generator, std::uint32_t range) {
+        std::uint64_t product = std::uint64_t{next32(generator)} * range;
+        auto low = static_cast<std::uint32_t>(product);
+        if (low < range) {
+            const std::uint32_t threshold = (0u - range) % range;
+            while (low < threshold) {
+                product = std::uint64_t{next32(generator)} * range;
+                low = static_cast<std::uint32_t>(product);
+            }
+        }
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+
+    template<typename G>
+    std::uint64_t bounded(G& generator, std::uint64_t range) {
+        if (range <= std::numeric_limits<std::uint32_t>::max())
+            return bounded(generator, static_cast<std::uint32_t>(range));
+#if defined(__SIZEOF_INT128__)
+        auto product = static_cast<unsigned __int128>(next64(generator)) * range;
+        auto low = static_cast<std::uint64_t>(product);
+        if (low < range) {
+            const std::uint64_t threshold = (0 - range) % range;
+            while (low < threshold) {
+                product = static_cast<unsigned __int128>(next64(generator)) * range;
+                low = static_cast<std::uint64_t>(product);
+            }
+        }
+        return static_cast<std::uint64_t>(product >> 64);
+#else
+        // no 128-bit product: reject the top numbers that would bias x % range
+        const std::uint64_t limit = std::numeric_limits<std::uint64_t>::max() - std::numeric_limits<std::uint64_t>::max() % range;
+        std::uint64_t x;
+        do {
+            x = next64(generator);
+        } while (x >= limit);
+        return x % range;
+#endif
+    }
+
+    /**
+     * Uniform in [min, max], both included: the unbiased rand() % (max - min + 1) + min
+     */
+    template<typename G, typename Int>
+    Int uniform_int(G& generator, Int min, Int max) {
+        static_assert(std::is_integral_v<Int>);
+        using Unsigned = std::make_unsigned_t<Int>;
+        const auto span = static_cast<std::uint64_t>(static_cast<Unsigned>(max) - static_cast<Unsigned>(min));
+        const std::uint64_t offset = span == std::numeric_limits<std::uint64_t>::max() ? next64(generator)
+                                                                                       : bounded(generator, span + 1);
+        return static_cast<Int>(static_cast<Unsigned>(static_cast<Unsigned>(min) + static_cast<Unsigned>(offset)));
+    }
+
+    /**
+     * Uniform in [0, 1), 53 random bits
+     */
+    template<typename G>
+    double canonical(G& generator) {
+        return static_cast<double>(next64(generator) >> 11) * 0x1.0p-53;
+    }
+
+    template<typename G>
+    void fill(G& generator, std::span<std::uint64_t> out) {
+        for (auto& value: out)
+            value = next64(generator);
+    }
+
+    template<typename G, typename Int>
+    void fill_uniform(G& generator, std::span<Int> out, Int min, Int max) {
+        for (auto& value: out)
+            value = uniform_int(generator, min, max);
+    }
+
+    template<typename G>
+    void fill_canonical(G& generator, std::span<double> out) {
+        for (auto& value: out)
+            value = canonical(generator);
+    }
+}
+
+#endif //SECTION_11_FUNCTIONS_RNG_H
@@ -0,0 +1,53 @@
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "pointer_utils.h"
+
+void bm_double_data(bench::State& state) {
+    int value{1};
+    while (state.keep_running()) {
+        double_data(&value);
+        bench::do_not_optimize(value);
+    }
+}
+BENCHMARK(bm_double_data);
+
+void bm_swap(bench::State& state) {
+    int a{1}, b{2};
+    while (state.keep_running()) {
+        swap(&a, &b);
+        bench::do_not_optimize(a);
+    }
+}
+BENCHMARK(bm_swap);
+
+void bm_create_int_array(bench::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    while (state.keep_running()) {
+        int *array = create_int_array(size, 7);
+        bench::do_not_optimize(array);
+        delete[] array;
+    }
+    state.set_bytes_processed(state.iterations() * size * sizeof(int));
+}
+BENCHMARK(bm_create_int_array)->range(10, 100000, 100);
+
+void bm_display_array(bench::State& state) {
+    size_t size = static_cast<size_t>(state.range(0));
+    int *array = create_int_array(size, 7);
+    while (state.keep_running())
+        display_array(array, size);
+    delete[] array;
+    state.set_items_processed(state.iterations() * size);
+}
+BENCHMARK(bm_display_array)->arg(100);
+
+void bm_display_vector(bench::State& state) {
+    const std::vector<std::string> words{"Larry", "Moe", "Curly"};
+    while (state.keep_running())
+        display(&words);
+}
+BENCHMARK(bm_display_vector);
+
+BENCHMARK_MAIN();
@@ -2,19 +2,9 @@
 #include <vector>
 #include <string>
 
-using namespace std;
-
-void double_data(int *int_ptr);
-
-void swap(int *a, int *b);
-
-void display(const vector<string> *const v);
+#include "pointer_utils.h"
 
-void display(int *, int);
-
-void display_array(int *, size_t &);
-
-int *create_int_array(size_t, int = 0);
+using namespace std;
 
 int main() {
 
@@ -634,54 +624,3 @@ int main() {
 //    system("pause");
     return 0;
 }
-
-/** (pass-by-reference)
- * Double the value stored at the location of the pointer.
- * @param int_ptr
- */
-void double_data(int *int_ptr) {
-    *int_ptr *= 2; // *int_ptr = *int_ptr * 2;
-}
-
-void swap(int *a, int *b) {
-    int temp = *a;
-    *a = *b;
-    *b = temp;
-}
-
-void display(const vector<string> *const v) {
-    for (auto s : *v) {
-        cout << s << " ";
-    }
-    cout << endl;
-//    (*v).at(0) = "Funny"; // ERROR
-//    v = nullptr;          // ERROR
-}
-
-void display(int *array, int sentinel) {
-
-    while (*array != sentinel) {
-        cout << *array++ << " ";
-    }
-    cout << endl;
-}
-
-int *create_int_array(size_t size, int initial_value) {
-    int *array{nullptr};
-    array = new int[size];
-
-    for (size_t i{0}; i < size; ++i) {
-        array[i] = initial_value;
-    }
-    return array;
-}
-
-void display_array(int *array, size_t &size) {
-    cout << " :: " << &size << endl;
-
-    for (size_t i{0}; i < size; i++) {
-        cout << array[i] << " ";
-    }
-    cout << endl;
-}
-
@@ -0,0 +1,56 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include <iostream>
+
+#include "pointer_utils.h"
+
+using namespace std;
+
+void double_data(int *int_ptr) {
+    *int_ptr *= 2; // *int_ptr = *int_ptr * 2;
+}
+
+void swap(int *a, int *b) {
+    int temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+void display(const vector<string> *const v) {
+    for (auto s : *v) {
+        cout << s << " ";
+    }
+    cout << endl;
+//    (*v).at(0) = "Funny"; // ERROR
+//    v = nullptr;          // ERROR
+}
+
+void display(int *array, int sentinel) {
+
+    while (*array != sentinel) {
+        cout << *array++ << " ";
+    }
+    cout << endl;
+}
+
+int *create_int_array(size_t size, int initial_value) {
+    int *array{nullptr};
+    array = new int[size];
+
+    for (size_t i{0}; i < size; ++i) {
+        array[i] = initial_value;
+    }
+    return array;
+}
+
+void display_array(int *array, size_t &size) {
+    cout << " :: " << &size << endl;
+
+    for (size_t i{0}; i < size; i++) {
+        cout << array[i] << " ";
+    }
+    cout << endl;
+}
+
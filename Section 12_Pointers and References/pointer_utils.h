@@ -0,0 +1,28 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_12_POINTERS_AND_REFERENCES_POINTER_UTILS_H
+#define SECTION_12_POINTERS_AND_REFERENCES_POINTER_UTILS_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/** (pass-by-reference)
+ * Double the value stored at the location of the pointer.
+ * @param int_ptr
+ */
+void double_data(int *int_ptr);
+
+void swap(int *a, int *b);
+
+void display(const std::vector<std::string> *const v);
+
+void display(int *, int);
+
+void display_array(int *, size_t &);
+
+int *create_int_array(size_t, int = 0);
+
+#endif //SECTION_12_POINTERS_AND_REFERENCES_POINTER_UTILS_H
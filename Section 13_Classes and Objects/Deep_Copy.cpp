@@ -3,11 +3,13 @@
 //
 
 #include "Deep_Copy.h"
+#include "alloc_tracker.h"
 #include <iostream>
 
 using namespace std;
 
 Deep_Copy::Deep_Copy(int d) {
+    ALLOC_TRACKER_SCOPE("Deep_Copy");
     data = new int;
     *data = d;
 }
@@ -17,6 +19,7 @@ Deep_Copy::Deep_Copy(int d) {
 //    cout << "Copy constructor - deep" << endl;
 //}
 Deep_Copy::Deep_Copy(const Deep_Copy &source) {
+    ALLOC_TRACKER_SCOPE("Deep_Copy");
     data = new int;
     *data = *source.data;
     cout << "Copy constructor - deep" << endl;
@@ -0,0 +1,47 @@
+#include <string>
+#include <vector>
+
+#include "benchmark.h"
+#include "Player.h"
+
+void bm_construct(bench::State& state) {
+    while (state.keep_running()) {
+        Player hero{"Hero"};
+        bench::do_not_optimize(hero);
+    }
+}
+BENCHMARK(bm_construct);
+
+void bm_copy(bench::State& state) {
+    Player hero{"Hero"};
+    while (state.keep_running()) {
+        Player copy{hero};
+        bench::do_not_optimize(copy);
+    }
+}
+BENCHMARK(bm_copy);
+
+void bm_damage(bench::State& state) {
+    Player hero{"Hero"};
+    while (state.keep_running()) {
+        hero.damage(1);
+        bool dead = hero.is_dead();
+        bench::do_not_optimize(dead);
+    }
+}
+BENCHMARK(bm_damage);
+
+void bm_vector_of_players(bench::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    while (state.keep_running()) {
+        std::vector<Player> players;
+        players.reserve(count);
+        for (std::size_t i{0}; i < count; i++)
+            players.emplace_back("minion");
+        bench::do_not_optimize(players.data());
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_vector_of_players)->arg(10)->arg(1000);
+
+BENCHMARK_MAIN();
@@ -1,6 +1,8 @@
 #include <iostream>
 #include <vector>
 
+#include "alloc_tracker.h"
+#include "buffered_writer.h"
 #include "Account.h"
 #include "Player.h"
 
@@ -16,11 +18,13 @@ public:
     int get_data_value() { return *data; }
 
     Move(int d) {
+        ALLOC_TRACKER_SCOPE("Move");
         data = new int;
         *data = d;
     }
 
     Move(const Move &source) {
+        ALLOC_TRACKER_SCOPE("Move");
         data = new int;
         *data = *source.data;
     }
@@ -38,6 +42,9 @@ public:
 
 
 int main() {
+    // the classes log every call with endl, write it through one big buffer instead
+    BufferedWriter out;
+    StreamRedirect redirect{cout, out};
     cout << boolalpha;
     /**
      * class Class_Name
@@ -1,13 +1,16 @@
 #include <cstring>
 #include <iostream>
 #include "MyString.h"
+#include "alloc_tracker.h"
 
 MyString::MyString() : str{nullptr} {
+    ALLOC_TRACKER_SCOPE("MyString");
     str = new char[1];
     *str = '\0';
 }
 
 MyString::MyString(const char *str) : str{nullptr} {
+    ALLOC_TRACKER_SCOPE("MyString");
     if (str == nullptr) {
         this->str = new char[1];
         *(this->str) = '\0'; // *this->str
@@ -18,6 +21,7 @@ MyString::MyString(const char *str) : str{nullptr} {
 }
 
 MyString::MyString(const MyString &source) : str{nullptr} {
+    ALLOC_TRACKER_SCOPE("MyString");
     str = new char[std::strlen(source.str) + 1];
     std::strcpy(str, source.str);
 }
@@ -28,6 +32,7 @@ MyString::MyString(MyString &&source) : str{source.str} {
 }
 
 MyString &MyString::operator=(const MyString &rhs) {
+    ALLOC_TRACKER_SCOPE("MyString");
     std::cout << "Using Copy Assignment\n";
     if (this == &rhs)
         return *this;
@@ -57,6 +62,7 @@ bool MyString::operator==(const MyString &rhs) const {
 }
 
 MyString MyString::operator+(const MyString &rhs) const {
+    ALLOC_TRACKER_SCOPE("MyString");
     size_t buff_size = std::strlen(str) + std::strlen(rhs.str) + 1;
 
     char *buff = new char[buff_size];
@@ -69,6 +75,7 @@ MyString MyString::operator+(const MyString &rhs) const {
 }
 
 MyString MyString::operator-() const {
+    ALLOC_TRACKER_SCOPE("MyString");
     char *buff = new char[std::strlen(str) + 1];
     std::strcpy(buff, str);
     for (size_t i = 0; i < std::strlen(buff); i++)
@@ -0,0 +1,69 @@
+#include "benchmark.h"
+#include "MyString.h"
+
+void bm_construct(bench::State& state) {
+    while (state.keep_running()) {
+        MyString s{"Hello, World"};
+        bench::do_not_optimize(s);
+    }
+}
+BENCHMARK(bm_construct);
+
+void bm_copy(bench::State& state) {
+    MyString source{"Hello, World"};
+    while (state.keep_running()) {
+        MyString copy{source};
+        bench::do_not_optimize(copy);
+    }
+}
+BENCHMARK(bm_copy);
+
+void bm_move(bench::State& state) {
+    while (state.keep_running()) {
+        MyString source{"Hello, World"};
+        MyString moved{std::move(source)};
+        bench::do_not_optimize(moved);
+    }
+}
+BENCHMARK(bm_move);
+
+void bm_copy_assignment(bench::State& state) {
+    MyString source{"Hello, World"};
+    MyString target{"Bye"};
+    while (state.keep_running()) {
+        target = source;
+        bench::do_not_optimize(target);
+    }
+}
+BENCHMARK(bm_copy_assignment);
+
+void bm_concatenate(bench::State& state) {
+    MyString lhs{"Hello, "};
+    MyString rhs{"World"};
+    while (state.keep_running()) {
+        MyString result = lhs + rhs;
+        bench::do_not_optimize(result);
+    }
+}
+BENCHMARK(bm_concatenate);
+
+void bm_lowercase(bench::State& state) {
+    MyString s{"HELLO, WORLD"};
+    while (state.keep_running()) {
+        MyString lower = -s;
+        bench::do_not_optimize(lower);
+    }
+}
+BENCHMARK(bm_lowercase);
+
+void bm_equals(bench::State& state) {
+    MyString a{"Hello, World"};
+    MyString b{"Hello, World"};
+    while (state.keep_running()) {
+        bool equal = a == b;
+        bench::do_not_optimize(equal);
+    }
+}
+BENCHMARK(bm_equals);
+
+BENCHMARK_MAIN();
@@ -1,5 +1,7 @@
 #include <iostream>
 
+#include "number_reader.h"
+
 using std::cin; // 'Imports' the "Console In" from the "Standard" namespace
 using namespace std; // 'Imports' the whole "Standard" namespace
 
@@ -32,10 +34,19 @@ int main() {
 //    cin >> num3;
 //    cout << "You entered: " << num3 << endl;
 
+    // from here on input goes through NumberReader (std::from_chars) instead of cin >>, errors say where they are
+    FileReader console{0};
+    NumberReader input{console};
+    input.tie(&cout);
+    auto read = [&input](auto& value) {
+        if (!input.read(value))
+            cerr << "Invalid input, " << input.error() << endl;
+    };
+
     cout << "Enter a integer";
-    cin >> num1;
+    read(num1);
     cout << "enter a double";
-    cin >> num3;
+    read(num3);
     cout << "You entered " << num1 << " and " << num3 << endl;
 
 }
@@ -0,0 +1,129 @@
+#include <cstdint>
+#include <vector>
+
+#include "benchmark.h"
+#include "matrix.h"
+
+/**
+ * Ratings of range(0) reviewers (rows) for range(1) movies (columns), 1 to 5 stars.
+ * Ratings are stored as bytes: 100K x 10K ints would be 4 GB per copy.
+ */
+namespace {
+    using Rating = std::uint8_t;
+
+    struct Ratings {
+        std::uint64_t state{0x9E3779B97F4A7C15ull};
+
+        Rating next() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return static_cast<Rating>(1 + (state >> 32) % 5);
+        }
+    };
+
+    std::vector<std::vector<Rating>> nested_ratings(std::size_t reviewers, std::size_t movies) {
+        Ratings ratings;
+        std::vector<std::vector<Rating>> result;
+        result.reserve(reviewers);
+        for (std::size_t r{0}; r < reviewers; r++) {
+            std::vector<Rating> row(movies);
+            for (auto& rating: row)
+                rating = ratings.next();
+            result.push_back(std::move(row));
+        }
+        return result;
+    }
+
+    Matrix<Rating> matrix_ratings(std::size_t reviewers, std::size_t movies) {
+        Ratings ratings;
+        Matrix<Rating> result(reviewers, movies);
+        for (std::size_t i{0}; i < reviewers * movies; i++)
+            result.raw()[i] = ratings.next();
+        return result;
+    }
+}
+
+void bm_nested_reviewer_average(bench::State& state) {
+    const auto ratings = nested_ratings(state.range(0), state.range(1));
+    std::vector<double> averages(ratings.size());
+    while (state.keep_running()) {
+        for (std::size_t r{0}; r < ratings.size(); r++) {
+            std::uint64_t sum{0};
+            for (Rating rating: ratings[r])
+                sum += rating;
+            averages[r] = static_cast<double>(sum) / ratings[r].size();
+        }
+        bench::do_not_optimize(averages.data());
+    }
+    state.set_items_processed(state.iterations() * state.range(0) * state.range(1));
+}
+BENCHMARK(bm_nested_reviewer_average)->args({100000, 10000})->iterations(1);
+
+void bm_matrix_reviewer_average(bench::State& state) {
+    const auto ratings = matrix_ratings(state.range(0), state.range(1));
+    std::vector<double> averages(ratings.rows());
+    while (state.keep_running()) {
+        for (std::size_t r{0}; r < ratings.rows(); r++) {
+            std::uint64_t sum{0};
+            for (Rating rating: ratings[r])
+                sum += rating;
+            averages[r] = static_cast<double>(sum) / ratings.cols();
+        }
+        bench::do_not_optimize(averages.data());
+    }
+    state.set_items_processed(state.iterations() * state.range(0) * state.range(1));
+}
+BENCHMARK(bm_matrix_reviewer_average)->args({100000, 10000})->iterations(1);
+
+void bm_nested_movie_average(bench::State& state) {
+    // the textbook loop: one movie at a time, down all the reviewers
+    const auto ratings = nested_ratings(state.range(0), state.range(1));
+    const std::size_t movies = state.range(1);
+    std::vector<double> averages(movies);
+    while (state.keep_running()) {
+        for (std::size_t m{0}; m < movies; m++) {
+            std::uint64_t sum{0};
+            for (const auto& row: ratings)
+                sum += row[m];
+            averages[m] = static_cast<double>(sum) / ratings.size();
+        }
+        bench::do_not_optimize(averages.data());
+    }
+    state.set_items_processed(state.iterations() * state.range(0) * state.range(1));
+}
+BENCHMARK(bm_nested_movie_average)->args({100000, 10000})->iterations(1);
+
+void bm_matrix_movie_average_column(bench::State& state) {
+    const auto ratings = matrix_ratings(state.range(0), state.range(1));
+    std::vector<double> averages(ratings.cols());
+    while (state.keep_running()) {
+        for (std::size_t m{0}; m < ratings.cols(); m++) {
+            std::uint64_t sum{0};
+            for (Rating rating: ratings.column(m))
+                sum += rating;
+            averages[m] = static_cast<double>(sum) / ratings.rows();
+        }
+        bench::do_not_optimize(averages.data());
+    }
+    state.set_items_processed(state.iterations() * state.range(0) * state.range(1));
+}
+BENCHMARK(bm_matrix_movie_average_column)->args({100000, 10000})->iterations(1);
+
+void bm_matrix_movie_average_blocked(bench::State& state) {
+    // same result, but the sums of a tile of columns stay in cache while the rows stream by
+    const auto ratings = matrix_ratings(state.range(0), state.range(1));
+    std::vector<std::uint32_t> sums(ratings.cols());
+    std::vector<double> averages(ratings.cols());
+    while (state.keep_running()) {
+        std::fill(sums.begin(), sums.end(), 0);
+        ratings.for_each_block([&sums](std::size_t, std::size_t movie, Rating rating) {
+            sums[movie] += rating;
+        }, 256, 4096);
+        for (std::size_t m{0}; m < ratings.cols(); m++)
+            averages[m] = static_cast<double>(sums[m]) / ratings.rows();
+        bench::do_not_optimize(averages.data());
+    }
+    state.set_items_processed(state.iterations() * state.range(0) * state.range(1));
+}
+BENCHMARK(bm_matrix_movie_average_blocked)->args({100000, 10000})->iterations(1);
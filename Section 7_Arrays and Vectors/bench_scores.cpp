@@ -0,0 +1,95 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "benchmark.h"
+#include "buffered_writer.h"
+#include "bulk_parse.h"
+#include "number_reader.h"
+
+/**
+ * range(0) test scores (0 to 100, 20 per line) written once to a temp file, about 1.7 GB for 500M
+ */
+std::filesystem::path scores_file(long long count) {
+    static std::filesystem::path path;
+    static long long written{0};
+    if (written != count) {
+        path = std::filesystem::temp_directory_path() / "section_7_scores.txt";
+        std::FILE* file = std::fopen(path.string().c_str(), "wb");
+        {
+            BufferedWriter out{file};
+            std::uint64_t state{0x9E3779B97F4A7C15ull};
+            for (long long i{0}; i < count; i++) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                out << static_cast<int>((state >> 32) % 101) << (i % 20 == 19 ? '\n' : ' ');
+            }
+        }
+        std::fclose(file);
+        written = count;
+        std::atexit([] { std::filesystem::remove(path); });
+    }
+    return path;
+}
+
+void bm_scores_cin_push_back(bench::State& state) {
+    // the Section 7 way: operator>> and push_back one score at a time
+    const auto path = scores_file(state.range(0));
+    std::size_t reallocations{0}, loaded{0};
+    while (state.keep_running()) {
+        std::ifstream in{path};
+        std::vector<int> scores;
+        int score{};
+        while (in >> score) {
+            if (scores.size() == scores.capacity())
+                ++reallocations;
+            scores.push_back(score);
+        }
+        loaded += scores.size();
+        bench::do_not_optimize(scores.data());
+    }
+    state.set_items_processed(loaded);
+    state.set_counter("reallocations", static_cast<double>(reallocations) / state.iterations());
+}
+BENCHMARK(bm_scores_cin_push_back)->arg(500'000'000)->iterations(1);
+
+void bm_scores_number_reader_push_back(bench::State& state) {
+    const auto path = scores_file(state.range(0));
+    std::size_t reallocations{0}, loaded{0};
+    while (state.keep_running()) {
+        FileReader file{path.string()};
+        NumberReader in{file};
+        std::vector<int> scores;
+        int score{};
+        while (in.read(score)) {
+            if (scores.size() == scores.capacity())
+                ++reallocations;
+            scores.push_back(score);
+        }
+        loaded += scores.size();
+        bench::do_not_optimize(scores.data());
+    }
+    state.set_items_processed(loaded);
+    state.set_counter("reallocations", static_cast<double>(reallocations) / state.iterations());
+}
+BENCHMARK(bm_scores_number_reader_push_back)->arg(500'000'000)->iterations(1);
+
+void bm_scores_parse_all(bench::State& state) {
+    const auto path = scores_file(state.range(0));
+    std::size_t reallocations{0}, loaded{0};
+    while (state.keep_running()) {
+        FileReader file{path.string()};
+        std::vector<int> scores;
+        ParseError error;
+        BulkParseStats stats;
+        parse_all(file.contents(), scores, error, &stats);
+        reallocations += stats.reallocations;
+        loaded += stats.values;
+        bench::do_not_optimize(scores.data());
+    }
+    state.set_items_processed(loaded);
+    state.set_counter("reallocations", static_cast<double>(reallocations) / state.iterations());
+}
+BENCHMARK(bm_scores_parse_all)->arg(500'000'000)->iterations(1);
@@ -0,0 +1,96 @@
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "benchmark.h"
+#include "sparse_ratings.h"
+
+/**
+ * Synthetic ratings: range(0) ratings spread uniformly over range(1) reviewers x range(2) movies.
+ * The registered size is 100M ratings at 2% density, about 1 GB for both layouts plus 1.2 GB of triples
+ * while building; 1B ratings needs a machine with ~30 GB.
+ */
+namespace {
+    struct Generator {
+        std::uint64_t state{0x2545F4914F6CDD1Dull};
+
+        std::uint64_t next() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        }
+    };
+
+    std::vector<RatingTriple> synthetic_ratings(std::size_t count, std::size_t reviewers, std::size_t movies) {
+        Generator generator;
+        std::vector<RatingTriple> triples(count);
+        for (auto& triple: triples) {
+            const auto bits = generator.next();
+            triple.reviewer = static_cast<std::uint32_t>((bits >> 32) % reviewers);
+            triple.movie = static_cast<std::uint32_t>((bits & 0xFFFFFFFFu) % movies);
+            triple.stars = static_cast<std::uint8_t>(1 + (bits >> 16) % 5);
+        }
+        return triples;
+    }
+
+    /**
+     * Built once and shared by the query benchmarks
+     */
+    SparseRatings& shared_ratings(std::size_t count, std::size_t reviewers, std::size_t movies) {
+        static std::unique_ptr<SparseRatings> ratings;
+        if (!ratings)
+            ratings = std::make_unique<SparseRatings>(reviewers, movies, synthetic_ratings(count, reviewers, movies));
+        return *ratings;
+    }
+}
+
+void bm_sparse_build(bench::State& state) {
+    while (state.keep_running()) {
+        state.pause_timing();
+        auto triples = synthetic_ratings(state.range(0), state.range(1), state.range(2));
+        state.resume_timing();
+        SparseRatings ratings{static_cast<std::size_t>(state.range(1)), static_cast<std::size_t>(state.range(2)), triples};
+        bench::do_not_optimize(ratings);
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+}
+BENCHMARK(bm_sparse_build)->args({100'000'000, 1'000'000, 5'000})->iterations(1);
+
+void bm_sparse_movie_averages(bench::State& state) {
+    auto& ratings = shared_ratings(100'000'000, 1'000'000, 5'000);
+    const auto threads = static_cast<unsigned>(state.range(0));
+    while (state.keep_running()) {
+        auto averages = ratings.movie_averages(threads);
+        bench::do_not_optimize(averages.data());
+    }
+    state.set_items_processed(state.iterations() * ratings.size());
+}
+BENCHMARK(bm_sparse_movie_averages)->arg(1)->arg(4)->iterations(5);
+
+void bm_sparse_top_movies(bench::State& state) {
+    auto& ratings = shared_ratings(100'000'000, 1'000'000, 5'000);
+    Generator generator;
+    while (state.keep_running()) {
+        auto top = ratings.top_movies(static_cast<std::uint32_t>(generator.next() % ratings.reviewers()), 10);
+        bench::do_not_optimize(top.data());
+    }
+}
+BENCHMARK(bm_sparse_top_movies);
+
+void bm_sparse_insert_and_merge(bench::State& state) {
+    // range(0) new ratings go through the delta buffer, then one merge into the 100M
+    auto& ratings = shared_ratings(100'000'000, 1'000'000, 5'000);
+    Generator generator;
+    while (state.keep_running()) {
+        for (long i{0}; i < state.range(0); i++) {
+            const auto bits = generator.next();
+            ratings.insert(static_cast<std::uint32_t>((bits >> 32) % ratings.reviewers()),
+                           static_cast<std::uint32_t>((bits & 0xFFFFFFFFu) % ratings.movies()),
+                           static_cast<std::uint8_t>(1 + (bits >> 16) % 5));
+        }
+        ratings.merge();
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+}
+BENCHMARK(bm_sparse_insert_and_merge)->arg(1'000'000)->iterations(1);
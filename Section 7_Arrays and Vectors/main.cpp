@@ -1,6 +1,11 @@
 #include <iostream>
 #include <vector>
 
+#include "bulk_parse.h"
+#include "matrix.h"
+#include "number_reader.h"
+#include "sparse_ratings.h"
+
 using namespace std;
 
 int main() {
@@ -139,10 +144,19 @@ int main() {
     cout << test_scores.at(2) << endl;
     cout << "\nThere are " << test_scores.size() << " scores in the vector" << endl;
 
+    // the scores are parsed by NumberReader, a typo is reported with its line and column
+    FileReader console{0};
+    NumberReader input{console};
+    input.tie(&cout);
+    auto read = [&input](auto& value) {
+        if (!input.read(value))
+            cerr << "Invalid input, " << input.error() << endl;
+    };
+
     cout << "\nEnter 3 scores: ";
-    cin >> test_scores.at(0);
-    cin >> test_scores.at(1);
-    cin >> test_scores.at(2);
+    read(test_scores.at(0));
+    read(test_scores.at(1));
+    read(test_scores.at(2));
 
     cout << "\nUpdated test scores" << endl;
     cout << test_scores.at(0) << endl;
@@ -151,11 +165,11 @@ int main() {
 
     cout << "\nEnter a test score to add to the vector: ";
     int score_to_add{0};
-    cin >> score_to_add;
+    read(score_to_add);
     test_scores.push_back(score_to_add);
 
     cout << "Enter one more score to the vector: ";
-    cin >> score_to_add;
+    read(score_to_add);
     test_scores.push_back(score_to_add);
 
     cout << "\nNew Test Scores" << endl;
@@ -167,11 +181,31 @@ int main() {
 
     cout << "\nAnd the new Size is: " << test_scores.size() << endl;
 
+    /**
+     * A whole class at once: parse_all reserves the vector once and parses the buffer in one pass,
+     * the loop over the scores needs no .at() since the vector only holds what was parsed
+     */
+    vector<int> class_scores;
+    ParseError score_error;
+    BulkParseStats load_stats;
+    if (!parse_all("100 95 87\n64 72 99\n88 91 70", class_scores, score_error, &load_stats))
+        cerr << "Invalid score, " << score_error << endl;
+    int total{0};
+    for (int score: class_scores)
+        total += score;
+    cout << "\n" << load_stats.values << " class scores, capacity " << load_stats.reserved
+         << ", reallocations " << load_stats.reallocations
+         << ", average " << static_cast<double>(total) / class_scores.size() << endl;
+
 //    cout << "\nThis throws an exception" << test_scores.at(10) << endl;
 
     //2 DIMENSIONAL VECTOR
 
-    vector<vector<int>> movie_ratings // vector of vectors
+    /**
+     * vector<vector<int>> would allocate every row on its own,
+     * Matrix keeps all the rows in one block and supports the same [][] and .at().at() syntax
+     */
+    Matrix<int> movie_ratings
             {
                     {1, 2, 3, 4},
                     {1, 2, 4, 4},
@@ -190,6 +224,34 @@ int main() {
     cout << movie_ratings.at(1).at(2) << endl;
     cout << movie_ratings.at(1).at(3) << endl;
 
+    cout << "\nAverage rating of every movie, walking down the columns" << endl;
+    for (size_t movie{0}; movie < movie_ratings.cols(); movie++) {
+        int sum{0};
+        for (int rating: movie_ratings.column(movie))
+            sum += rating;
+        cout << "movie #" << movie + 1 << ": " << static_cast<double>(sum) / movie_ratings.rows() << endl;
+    }
+
+    /**
+     * Most reviewers never see most movies: SparseRatings only stores the ratings that exist
+     */
+    vector<RatingTriple> triples;
+    for (uint32_t reviewer{0}; reviewer < movie_ratings.rows(); reviewer++)
+        for (uint32_t movie{0}; movie < movie_ratings.cols(); movie++)
+            triples.push_back({reviewer, movie, static_cast<uint8_t>(movie_ratings(reviewer, movie))});
+    SparseRatings sparse_ratings{1000, 500, triples};
+    sparse_ratings.insert(999, 499, 5);
+    sparse_ratings.insert(2, 0, 5);
+    cout << "\nSparse ratings: " << sparse_ratings.size() << " stored, " << sparse_ratings.pending() << " pending" << endl;
+    sparse_ratings.merge();
+    cout << "After the merge: " << sparse_ratings.size() << " stored" << endl;
+    auto averages = sparse_ratings.movie_averages();
+    cout << "movie #1 average: " << averages.at(0) << ", movie #500 average: " << averages.at(499) << endl;
+    cout << "Top 2 movies of reviewer #3:";
+    for (const auto& rating: sparse_ratings.top_movies(2, 2))
+        cout << " movie #" << rating.movie + 1 << " (" << static_cast<int>(rating.stars) << ")";
+    cout << endl;
+
 
 
     // SECTION CHALLENGE
@@ -205,14 +267,14 @@ int main() {
 
     cout << "\nvector2" << endl << vector2.at(0) << endl << vector2.at(1) << endl << "Size=" << vector2.size() << endl;
 
-    vector<vector<int>> vector_2d;
-    vector_2d.push_back(vector1);
-    vector_2d.push_back(vector2);
+    Matrix<int> vector_2d;
+    vector_2d.append_row(vector1);
+    vector_2d.append_row(vector2);
 
     cout << "\nVector 2D" << endl;
     cout << vector_2d.at(0).at(0) << endl << vector_2d.at(0).at(1) << endl;
     cout << vector_2d.at(1).at(0) << endl << vector_2d.at(1).at(1) << endl;
-    cout << "Size=" << vector_2d.size();
+    cout << "Size=" << vector_2d.rows();
 
 
     return 0;
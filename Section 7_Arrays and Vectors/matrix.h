@@ -0,0 +1,249 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_7_ARRAYS_AND_VECTORS_MATRIX_H
+#define SECTION_7_ARRAYS_AND_VECTORS_MATRIX_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * One row of a Matrix, contiguous: [] is unchecked, at() is bounds-checked like std::vector
+ */
+template<typename T>
+class MatrixRow {
+private:
+    T* first;
+    std::size_t count;
+public:
+    MatrixRow(T* first, std::size_t count) : first{first}, count{count} {}
+
+    std::size_t size() const { return count; }
+
+    T* begin() const { return first; }
+
+    T* end() const { return first + count; }
+
+    T& operator[](std::size_t col) const { return first[col]; }
+
+    T& at(std::size_t col) const {
+        if (col >= count)
+            throw std::out_of_range{"MatrixRow::at: column " + std::to_string(col) + " >= " + std::to_string(count)};
+        return first[col];
+    }
+};
+
+/**
+ * One column of a Matrix: every element is a row length away from the previous one.
+ * Positions are kept as indexes into the matrix data, never as pointers past its end
+ */
+template<typename T>
+class MatrixColumn {
+private:
+    T* data;
+    std::size_t col;
+    std::size_t count;
+    std::size_t stride;
+public:
+    class Iterator {
+    private:
+        T* data;
+        std::size_t index;
+        std::size_t stride;
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::remove_const_t<T>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        Iterator(T* data, std::size_t index, std::size_t stride) : data{data}, index{index}, stride{stride} {}
+
+        T& operator*() const { return data[index]; }
+
+        Iterator& operator++() {
+            index += stride;
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous{*this};
+            index += stride;
+            return previous;
+        }
+
+        bool operator==(const Iterator& other) const { return index == other.index; }
+
+        bool operator!=(const Iterator& other) const { return index != other.index; }
+    };
+
+    MatrixColumn(T* data, std::size_t col, std::size_t count, std::size_t stride)
+            : data{data}, col{col}, count{count}, stride{stride} {}
+
+    std::size_t size() const { return count; }
+
+    Iterator begin() const { return Iterator{data, col, stride}; }
+
+    Iterator end() const { return Iterator{data, col + count * stride, stride}; }
+
+    T& operator[](std::size_t row) const { return data[row * stride + col]; }
+
+    T& at(std::size_t row) const {
+        if (row >= count)
+            throw std::out_of_range{"MatrixColumn::at: row " + std::to_string(row) + " >= " + std::to_string(count)};
+        return data[row * stride + col];
+    }
+};
+
+/**
+ * Row-major 2D array in one allocation, the replacement of vector<vector<T>>:
+ *
+ * Matrix<int> movie_ratings{{1, 2, 3, 4},
+ *                           {1, 2, 4, 4}};
+ * movie_ratings[0][1];        // unchecked
+ * movie_ratings.at(1).at(3);  // bounds-checked, throws std::out_of_range
+ * movie_ratings.column(2);    // view of the ratings of the third movie
+ *
+ * All rows have the same length.
+ */
+template<typename T>
+class Matrix {
+private:
+    std::size_t row_count{0};
+    std::size_t col_count{0};
+    std::vector<T> data;
+
+    void check(std::size_t row, std::size_t col) const {
+        if (row >= row_count || col >= col_count)
+            throw std::out_of_range{"Matrix: (" + std::to_string(row) + ", " + std::to_string(col) +
+                                    ") outside " + std::to_string(row_count) + "x" + std::to_string(col_count)};
+    }
+
+    void check_row(std::size_t row) const {
+        if (row >= row_count)
+            throw std::out_of_range{"Matrix: row " + std::to_string(row) + " >= " + std::to_string(row_count)};
+    }
+
+    void check_col(std::size_t col) const {
+        if (col >= col_count)
+            throw std::out_of_range{"Matrix: column " + std::to_string(col) + " >= " + std::to_string(col_count)};
+    }
+
+public:
+    Matrix() = default;
+
+    Matrix(std::size_t rows, std::size_t cols, const T& value = T{})
+            : row_count{rows}, col_count{cols}, data(rows * cols, value) {}
+
+    Matrix(std::initializer_list<std::initializer_list<T>> rows) {
+        for (const auto& row: rows)
+            append_row(row);
+    }
+
+    std::size_t rows() const { return row_count; }
+
+    std::size_t cols() const { return col_count; }
+
+    bool empty() const { return data.empty(); }
+
+    T* raw() { return data.data(); }
+
+    const T* raw() const { return data.data(); }
+
+    void reserve_rows(std::size_t rows) { data.reserve(rows * col_count); }
+
+    /**
+     * Adds a row at the end, the first row decides the number of columns
+     */
+    template<typename Range>
+    void append_row(const Range& row) {
+        const auto length = static_cast<std::size_t>(std::distance(std::begin(row), std::end(row)));
+        if (row_count == 0 && col_count == 0)
+            col_count = length;
+        else if (length != col_count)
+            throw std::invalid_argument{"Matrix::append_row: row of " + std::to_string(length) +
+                                        " values in a matrix of " + std::to_string(col_count) + " columns"};
+        data.insert(data.end(), std::begin(row), std::end(row));
+        ++row_count;
+    }
+
+    T& operator()(std::size_t row, std::size_t col) { return data[row * col_count + col]; }
+
+    const T& operator()(std::size_t row, std::size_t col) const { return data[row * col_count + col]; }
+
+    T& at(std::size_t row, std::size_t col) {
+        check(row, col);
+        return data[row * col_count + col];
+    }
+
+    const T& at(std::size_t row, std::size_t col) const {
+        check(row, col);
+        return data[row * col_count + col];
+    }
+
+    MatrixRow<T> operator[](std::size_t row) { return {data.data() + row * col_count, col_count}; }
+
+    MatrixRow<const T> operator[](std::size_t row) const { return {data.data() + row * col_count, col_count}; }
+
+    MatrixRow<T> at(std::size_t row) {
+        check_row(row);
+        return (*this)[row];
+    }
+
+    MatrixRow<const T> at(std::size_t row) const {
+        check_row(row);
+        return (*this)[row];
+    }
+
+    MatrixRow<T> row(std::size_t row) { return at(row); }
+
+    MatrixRow<const T> row(std::size_t row) const { return at(row); }
+
+    MatrixColumn<T> column(std::size_t col) {
+        check_col(col);
+        return {data.data(), col, row_count, col_count};
+    }
+
+    MatrixColumn<const T> column(std::size_t col) const {
+        check_col(col);
+        return {data.data(), col, row_count, col_count};
+    }
+
+    /**
+     * Calls f(row, col, value) tile by tile, so that column-wise work on a tall matrix stays in cache:
+     * a tile of block_rows x block_cols should fit in L1/L2
+     */
+    template<typename F>
+    void for_each_block(F f, std::size_t block_rows = 64, std::size_t block_cols = 1024) const {
+        for (std::size_t row_begin{0}; row_begin < row_count; row_begin += block_rows) {
+            const std::size_t row_end = row_begin + block_rows < row_count ? row_begin + block_rows : row_count;
+            for (std::size_t col_begin{0}; col_begin < col_count; col_begin += block_cols) {
+                const std::size_t col_end = col_begin + block_cols < col_count ? col_begin + block_cols : col_count;
+                for (std::size_t row{row_begin}; row < row_end; row++) {
+                    const T* values = data.data() + row * col_count;
+                    for (std::size_t col{col_begin}; col < col_end; col++)
+                        f(row, col, values[col]);
+                }
+            }
+        }
+    }
+
+    /**
+     * Copy with rows and columns swapped, built tile by tile
+     */
+    Matrix transposed(std::size_t block = 64) const {
+        Matrix result(col_count, row_count);
+        for_each_block([&result](std::size_t row, std::size_t col, const T& value) {
+            result(col, row) = value;
+        }, block, block);
+        return result;
+    }
+};
+
+#endif //SECTION_7_ARRAYS_AND_VECTORS_MATRIX_H
@@ -0,0 +1,235 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "sparse_ratings.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "parallel.h"
+
+namespace {
+    /**
+     * CSR of the triples, rows sorted by index, the last of duplicate (row, index) triples wins
+     */
+    CompressedRatings compress(std::size_t rows, const std::vector<RatingTriple>& triples) {
+        CompressedRatings result;
+        result.offsets.assign(rows + 1, 0);
+        for (const auto& triple: triples)
+            ++result.offsets[triple.reviewer + 1];
+        for (std::size_t r{0}; r < rows; r++)
+            result.offsets[r + 1] += result.offsets[r];
+
+        // scattering keeps the input order inside a row
+        std::vector<std::uint32_t> movies(triples.size());
+        std::vector<std::uint8_t> stars(triples.size());
+        std::vector<std::uint64_t> next(result.offsets.begin(), result.offsets.end() - 1);
+        for (const auto& triple: triples) {
+            const auto at = next[triple.reviewer]++;
+            movies[at] = triple.movie;
+            stars[at] = triple.stars;
+        }
+
+        result.index.reserve(triples.size());
+        result.stars.reserve(triples.size());
+        std::vector<std::uint64_t> keys;
+        std::uint64_t row_begin{0};
+        for (std::size_t r{0}; r < rows; r++) {
+            const std::uint64_t row_end = result.offsets[r + 1];
+            // (movie, position in the row) so the last rating of a movie sorts last
+            keys.clear();
+            for (std::uint64_t i{row_begin}; i < row_end; i++)
+                keys.push_back(static_cast<std::uint64_t>(movies[i]) << 32 | (i - row_begin));
+            std::sort(keys.begin(), keys.end());
+            result.offsets[r] = result.index.size();
+            for (std::size_t k{0}; k < keys.size(); k++) {
+                if (k + 1 < keys.size() && keys[k + 1] >> 32 == keys[k] >> 32)
+                    continue;
+                result.index.push_back(static_cast<std::uint32_t>(keys[k] >> 32));
+                result.stars.push_back(stars[row_begin + (keys[k] & 0xFFFFFFFFu)]);
+            }
+            row_begin = row_end;
+        }
+        result.offsets[rows] = result.index.size();
+        return result;
+    }
+
+    /**
+     * The same ratings by column, rows come out sorted because they are visited in order
+     */
+    CompressedRatings transpose(const CompressedRatings& rows, std::size_t cols) {
+        CompressedRatings result;
+        result.offsets.assign(cols + 1, 0);
+        for (auto col: rows.index)
+            ++result.offsets[col + 1];
+        for (std::size_t c{0}; c < cols; c++)
+            result.offsets[c + 1] += result.offsets[c];
+        result.index.resize(rows.size());
+        result.stars.resize(rows.size());
+        std::vector<std::uint64_t> next(result.offsets.begin(), result.offsets.end() - 1);
+        const std::size_t row_count = rows.offsets.size() - 1;
+        for (std::size_t r{0}; r < row_count; r++) {
+            for (std::uint64_t i{rows.offsets[r]}; i < rows.offsets[r + 1]; i++) {
+                const auto at = next[rows.index[i]]++;
+                result.index[at] = static_cast<std::uint32_t>(r);
+                result.stars[at] = rows.stars[i];
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Row by row merge of two sorted CSRs, the delta wins on equal (row, index)
+     */
+    CompressedRatings merge_rows(const CompressedRatings& base, const CompressedRatings& delta) {
+        CompressedRatings result;
+        const std::size_t rows = base.offsets.size() - 1;
+        result.offsets.resize(rows + 1);
+        result.index.reserve(base.size() + delta.size());
+        result.stars.reserve(base.size() + delta.size());
+        for (std::size_t r{0}; r < rows; r++) {
+            result.offsets[r] = result.index.size();
+            auto i = base.offsets[r], i_end = base.offsets[r + 1];
+            auto j = delta.offsets[r], j_end = delta.offsets[r + 1];
+            while (i < i_end || j < j_end) {
+                if (j == j_end || (i < i_end && base.index[i] < delta.index[j])) {
+                    result.index.push_back(base.index[i]);
+                    result.stars.push_back(base.stars[i++]);
+                } else {
+                    if (i < i_end && base.index[i] == delta.index[j])
+                        ++i;
+                    result.index.push_back(delta.index[j]);
+                    result.stars.push_back(delta.stars[j++]);
+                }
+            }
+        }
+        result.offsets[rows] = result.index.size();
+        return result;
+    }
+}
+
+SparseRatings::SparseRatings(std::size_t reviewers, std::size_t movies, const std::vector<RatingTriple>& triples,
+                             std::size_t merge_threshold)
+        : reviewer_count{reviewers}, movie_count{movies}, merge_threshold{merge_threshold} {
+    for (const auto& triple: triples)
+        check(triple.reviewer, triple.movie, triple.stars);
+    auto snapshot = std::make_shared<Snapshot>();
+    snapshot->by_reviewer = compress(reviewer_count, triples);
+    snapshot->by_movie = transpose(snapshot->by_reviewer, movie_count);
+    current = std::move(snapshot);
+    merger = std::thread{&SparseRatings::run_merger, this};
+}
+
+SparseRatings::~SparseRatings() {
+    {
+        std::lock_guard<std::mutex> lock{delta_mutex};
+        stopping = true;
+    }
+    delta_full.notify_one();
+    merger.join();
+}
+
+void SparseRatings::check_reviewer(std::uint32_t reviewer) const {
+    if (reviewer >= reviewer_count)
+        throw std::out_of_range{"SparseRatings: reviewer " + std::to_string(reviewer) + " >= " +
+                                std::to_string(reviewer_count)};
+}
+
+void SparseRatings::check(std::uint32_t reviewer, std::uint32_t movie) const {
+    if (reviewer >= reviewer_count || movie >= movie_count)
+        throw std::out_of_range{"SparseRatings: rating (" + std::to_string(reviewer) + ", " + std::to_string(movie) +
+                                ") outside " + std::to_string(reviewer_count) + "x" + std::to_string(movie_count)};
+}
+
+void SparseRatings::check(std::uint32_t reviewer, std::uint32_t movie, std::uint8_t stars) const {
+    check(reviewer, movie);
+    if (stars < 1 || stars > 5)
+        throw std::invalid_argument{"SparseRatings: " + std::to_string(stars) + " stars, expected 1 to 5"};
+}
+
+std::shared_ptr<const SparseRatings::Snapshot> SparseRatings::snapshot() const {
+    std::lock_guard<std::mutex> lock{snapshot_mutex};
+    return current;
+}
+
+void SparseRatings::insert(std::uint32_t reviewer, std::uint32_t movie, std::uint8_t stars) {
+    check(reviewer, movie, stars);
+    bool full;
+    {
+        std::lock_guard<std::mutex> lock{delta_mutex};
+        delta.push_back({reviewer, movie, stars});
+        full = delta.size() >= merge_threshold;
+    }
+    if (full)
+        delta_full.notify_one();
+}
+
+std::size_t SparseRatings::pending() {
+    std::lock_guard<std::mutex> lock{delta_mutex};
+    return delta.size();
+}
+
+void SparseRatings::merge() {
+    std::lock_guard<std::mutex> merging{merge_mutex};
+    std::vector<RatingTriple> batch;
+    {
+        std::lock_guard<std::mutex> lock{delta_mutex};
+        batch.swap(delta);
+    }
+    if (batch.empty())
+        return;
+    const auto base = snapshot();
+    auto next = std::make_shared<Snapshot>();
+    next->by_reviewer = merge_rows(base->by_reviewer, compress(reviewer_count, batch));
+    next->by_movie = transpose(next->by_reviewer, movie_count);
+    std::lock_guard<std::mutex> lock{snapshot_mutex};
+    current = std::move(next);
+}
+
+void SparseRatings::run_merger() {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock{delta_mutex};
+            delta_full.wait(lock, [this] { return stopping || delta.size() >= merge_threshold; });
+            if (stopping)
+                return;
+        }
+        merge();
+    }
+}
+
+std::vector<double> SparseRatings::movie_averages(unsigned threads) const {
+    const auto ratings = snapshot();
+    const auto& by_movie = ratings->by_movie;
+    std::vector<double> averages(movie_count);
+    auto average = [&by_movie, &averages](std::size_t first, std::size_t last) {
+        for (std::size_t m{first}; m < last; m++) {
+            const auto begin = by_movie.offsets[m], end = by_movie.offsets[m + 1];
+            std::uint64_t sum{0};
+            for (auto i{begin}; i < end; i++)
+                sum += by_movie.stars[i];
+            averages[m] = begin == end ? 0.0 : static_cast<double>(sum) / static_cast<double>(end - begin);
+        }
+    };
+    // threads = 0 (hardware_concurrency() unknown) counts as one thread
+    parallel::split(movie_count, parallel::threads_for(movie_count, std::max(1u, threads), 0),
+                    [&average](unsigned, std::size_t first, std::size_t last) { average(first, last); });
+    return averages;
+}
+
+std::vector<MovieRating> SparseRatings::top_movies(std::uint32_t reviewer, std::size_t n) const {
+    check_reviewer(reviewer);
+    const auto ratings = snapshot();
+    const auto& by_reviewer = ratings->by_reviewer;
+    std::vector<MovieRating> movies;
+    for (auto i{by_reviewer.offsets[reviewer]}; i < by_reviewer.offsets[reviewer + 1]; i++)
+        movies.push_back({by_reviewer.index[i], by_reviewer.stars[i]});
+    n = std::min(n, movies.size());
+    std::partial_sort(movies.begin(), movies.begin() + n, movies.end(), [](const MovieRating& a, const MovieRating& b) {
+        return a.stars != b.stars ? a.stars > b.stars : a.movie < b.movie;
+    });
+    movies.resize(n);
+    return movies;
+}
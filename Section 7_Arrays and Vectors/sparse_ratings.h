@@ -0,0 +1,142 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_7_ARRAYS_AND_VECTORS_SPARSE_RATINGS_H
+#define SECTION_7_ARRAYS_AND_VECTORS_SPARSE_RATINGS_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * One rating: reviewer gave movie 1 to 5 stars
+ */
+struct RatingTriple {
+    std::uint32_t reviewer;
+    std::uint32_t movie;
+    std::uint8_t stars;
+};
+
+struct MovieRating {
+    std::uint32_t movie;
+    std::uint8_t stars;
+};
+
+/**
+ * Compressed sparse rows: the entries of row r are [offsets[r], offsets[r + 1]) of index / stars,
+ * sorted by index
+ */
+struct CompressedRatings {
+    std::vector<std::uint64_t> offsets;
+    std::vector<std::uint32_t> index;
+    std::vector<std::uint8_t> stars;
+
+    std::size_t size() const { return index.size(); }
+};
+
+/**
+ * Ratings stored twice: by reviewer (CSR, a row per reviewer) and by movie (CSC, a column per movie),
+ * so both per-reviewer and per-movie queries read contiguous memory.
+ *
+ * movie_ratings of Section 7 as a sparse matrix: only the ratings that exist take memory.
+ *
+ * insert() only appends to a delta buffer. A background thread merges it into a new version
+ * once it holds merge_threshold ratings (or merge() does it right away), queries read the last merged
+ * version and never wait for a merge. When a reviewer rates a movie twice the last rating wins.
+ */
+class SparseRatings {
+public:
+    struct Snapshot {
+        CompressedRatings by_reviewer;
+        CompressedRatings by_movie;
+    };
+
+private:
+    std::size_t reviewer_count;
+    std::size_t movie_count;
+    std::size_t merge_threshold;
+
+    mutable std::mutex snapshot_mutex;
+    std::shared_ptr<const Snapshot> current;
+
+    std::mutex delta_mutex;
+    std::condition_variable delta_full;
+    std::vector<RatingTriple> delta;
+    bool stopping{false};
+
+    // one merge at a time, from the worker or merge()
+    std::mutex merge_mutex;
+    std::thread merger;
+
+    void check_reviewer(std::uint32_t reviewer) const;
+
+    void check(std::uint32_t reviewer, std::uint32_t movie) const;
+
+    void check(std::uint32_t reviewer, std::uint32_t movie, std::uint8_t stars) const;
+
+    void run_merger();
+
+public:
+    static constexpr std::size_t default_merge_threshold{1 << 20};
+
+    /**
+     * Throws std::out_of_range when a triple is outside reviewers x movies
+     */
+    SparseRatings(std::size_t reviewers, std::size_t movies, const std::vector<RatingTriple>& triples,
+                  std::size_t merge_threshold = default_merge_threshold);
+
+    SparseRatings(const SparseRatings&) = delete;
+
+    SparseRatings& operator=(const SparseRatings&) = delete;
+
+    /**
+     * Stops the merge thread, ratings still in the delta buffer are dropped
+     */
+    ~SparseRatings();
+
+    std::size_t reviewers() const { return reviewer_count; }
+
+    std::size_t movies() const { return movie_count; }
+
+    /**
+     * The last merged version, stays valid while it is held
+     */
+    std::shared_ptr<const Snapshot> snapshot() const;
+
+    /**
+     * Merged ratings
+     */
+    std::size_t size() const { return snapshot()->by_reviewer.size(); }
+
+    /**
+     * Throws std::out_of_range outside reviewers x movies and std::invalid_argument for stars outside 1 to 5
+     */
+    void insert(std::uint32_t reviewer, std::uint32_t movie, std::uint8_t stars);
+
+    /**
+     * Ratings waiting in the delta buffer
+     */
+    std::size_t pending();
+
+    /**
+     * Merges the delta buffer now
+     */
+    void merge();
+
+    /**
+     * Average stars of every movie (0 for movies without ratings), the movies are split between threads
+     */
+    std::vector<double> movie_averages(unsigned threads = std::thread::hardware_concurrency()) const;
+
+    /**
+     * The n best rated movies of a reviewer, ties by movie number
+     */
+    std::vector<MovieRating> top_movies(std::uint32_t reviewer, std::size_t n) const;
+};
+
+#endif //SECTION_7_ARRAYS_AND_VECTORS_SPARSE_RATINGS_H
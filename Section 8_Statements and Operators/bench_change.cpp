@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "benchmark.h"
+#include "coin_change.h"
+
+/**
+ * range(0) payouts of 0 to $10,000, made in blocks of 1M so the counts (20 bytes per payout)
+ * stay in a reused buffer instead of 2 GB for 100M payouts
+ */
+namespace {
+    constexpr std::size_t block{1 << 20};
+
+    std::vector<std::uint32_t> payouts(std::size_t n, std::uint32_t max = 1'000'000) {
+        std::vector<std::uint32_t> amounts(n);
+        std::uint64_t state{42};
+        for (auto& amount: amounts) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            amount = static_cast<std::uint32_t>((state >> 32) % (max + 1));
+        }
+        return amounts;
+    }
+}
+
+void bm_change_divisions(bench::State& state) {
+    // the % chain of the Section 8 challenge
+    const auto amounts = payouts(state.range(0));
+    std::vector<std::uint32_t> counts(block * 5);
+    while (state.keep_running()) {
+        for (std::size_t first{0}; first < amounts.size(); first += block) {
+            const std::size_t last = std::min(amounts.size(), first + block);
+            std::uint32_t* out = counts.data();
+            for (std::size_t i{first}; i < last; i++) {
+                std::uint32_t cents = amounts[i];
+                out[0] = cents / 100;
+                cents %= 100;
+                out[1] = cents / 25;
+                cents %= 25;
+                out[2] = cents / 10;
+                cents %= 10;
+                out[3] = cents / 5;
+                out[4] = cents % 5;
+                out += 5;
+            }
+            bench::do_not_optimize(counts.data());
+        }
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+}
+BENCHMARK(bm_change_divisions)->arg(100'000'000)->iterations(1);
+
+void bm_change_table(bench::State& state) {
+    const auto amounts = payouts(state.range(0));
+    const auto& coins = change::us_coins();
+    std::vector<std::uint32_t> counts(block * coins.size());
+    while (state.keep_running()) {
+        for (std::size_t first{0}; first < amounts.size(); first += block) {
+            const std::size_t n = std::min(block, amounts.size() - first);
+            coins.make_change(std::span{amounts}.subspan(first, n), std::span{counts}.first(n * coins.size()));
+            bench::do_not_optimize(counts.data());
+        }
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+}
+BENCHMARK(bm_change_table)->arg(100'000'000)->iterations(1);
+
+void bm_change_non_canonical(bench::State& state) {
+    // 4/3/1 style coins where the chain of divisions is wrong: the same table lookup
+    const auto amounts = payouts(state.range(0));
+    const change::CoinSystem coins{{100, 40, 25, 10, 1}};
+    std::vector<std::uint32_t> counts(block * coins.size());
+    while (state.keep_running()) {
+        for (std::size_t first{0}; first < amounts.size(); first += block) {
+            const std::size_t n = std::min(block, amounts.size() - first);
+            coins.make_change(std::span{amounts}.subspan(first, n), std::span{counts}.first(n * coins.size()));
+            bench::do_not_optimize(counts.data());
+        }
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+    state.set_counter("rows", static_cast<double>(coins.table_rows()));
+}
+BENCHMARK(bm_change_non_canonical)->arg(100'000'000)->iterations(1);
+
+void bm_count_coins(bench::State& state) {
+    const auto amounts = payouts(state.range(0));
+    const auto& coins = change::us_coins();
+    std::vector<std::uint32_t> totals(block);
+    while (state.keep_running()) {
+        for (std::size_t first{0}; first < amounts.size(); first += block) {
+            const std::size_t n = std::min(block, amounts.size() - first);
+            coins.count_coins(std::span{amounts}.subspan(first, n), std::span{totals}.first(n));
+            bench::do_not_optimize(totals.data());
+        }
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+}
+BENCHMARK(bm_count_coins)->arg(100'000'000)->iterations(1);
+
+/**
+ * Coins of the latency benchmarks: range(1) 0 is 100/25/10/5/1 (canonical, 100 rows),
+ * 1 the old British 30/24/12/6/3/1 pence (greedy wrong from 48 on, 254 rows)
+ */
+const change::CoinSystem& coin_system(std::int64_t id) {
+    static const change::CoinSystem old_pence{{30, 24, 12, 6, 3, 1}};
+    return id == 0 ? change::us_coins() : old_pence;
+}
+
+void bm_change_latency(bench::State& state) {
+    // one query at a time for amounts up to range(0), timed one by one (the clock adds ~20 ns)
+    const auto amounts = payouts(1 << 20, static_cast<std::uint32_t>(state.range(0)));
+    const auto& coins = coin_system(state.range(1));
+    std::vector<std::uint32_t> counts(coins.size());
+    std::vector<double> latencies(amounts.size());
+    while (state.keep_running()) {
+        for (std::size_t i{0}; i < amounts.size(); i++) {
+            const auto start = std::chrono::steady_clock::now();
+            coins.make_change(amounts[i], counts);
+            bench::do_not_optimize(counts.data());
+            latencies[i] = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        }
+    }
+    std::sort(latencies.begin(), latencies.end());
+    state.set_items_processed(state.iterations() * static_cast<std::int64_t>(amounts.size()));
+    state.set_counter("p50_ns", latencies[latencies.size() / 2]);
+    state.set_counter("p99_ns", latencies[latencies.size() * 99 / 100]);
+}
+BENCHMARK(bm_change_latency)->args({10'000'000, 0})->args({10'000'000, 1})->iterations(1);
+
+void bm_change_threads(bench::State& state) {
+    // 100M queries up to 10^7, the threads share one read only table
+    const auto amounts = payouts(100'000'000, 10'000'000);
+    const auto& coins = coin_system(state.range(1));
+    const auto threads = static_cast<unsigned>(state.range(0));
+    std::vector<std::uint32_t> totals(amounts.size());
+    while (state.keep_running()) {
+        coins.count_coins(amounts, totals, threads);
+        bench::do_not_optimize(totals.data());
+    }
+    state.set_items_processed(state.iterations() * static_cast<std::int64_t>(amounts.size()));
+}
+BENCHMARK(bm_change_threads)->args({1, 1})->args({4, 1})->iterations(1);
+
+BENCHMARK_MAIN();
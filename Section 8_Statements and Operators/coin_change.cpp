@@ -0,0 +1,172 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "coin_change.h"
+
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+
+#include "parallel.h"
+
+namespace change {
+    CoinSystem::CoinSystem(std::vector<std::uint32_t> coins, std::size_t max_rows) : coins_{std::move(coins)} {
+        std::sort(coins_.begin(), coins_.end(), std::greater<>{});
+        if (coins_.empty() || coins_.back() == 0)
+            throw std::invalid_argument{"CoinSystem: needs coins above 0"};
+        if (std::adjacent_find(coins_.begin(), coins_.end()) != coins_.end())
+            throw std::invalid_argument{"CoinSystem: every coin must be different"};
+
+        const std::uint64_t largest{coins_[0]};
+        std::uint64_t bound{0};
+        for (std::size_t i{1}; i < coins_.size(); i++)
+            bound += std::lcm(largest, std::uint64_t{coins_[i]}) - coins_[i];
+        if (bound + largest > max_rows)
+            throw std::length_error{"CoinSystem: the change table would be too large"};
+        bound_ = static_cast<std::uint32_t>(bound);
+        if (largest > 1)
+            magic_ = std::numeric_limits<std::uint64_t>::max() / largest + 1;
+        stride_ = coins_.size() + 1;
+
+        // best payment of n = best payment of n - c plus c, largest coin first so ties keep the large coins
+        const auto rows = static_cast<std::size_t>(bound + largest);
+        const std::size_t k = coins_.size();
+        table_.assign(rows * stride_, 0);
+        for (std::size_t n{1}; n < rows; n++) {
+            std::uint32_t* current = table_.data() + n * stride_;
+            std::uint32_t best{unpayable};
+            std::size_t best_coin{0};
+            for (std::size_t i{0}; i < k; i++) {
+                if (coins_[i] > n)
+                    continue;
+                const std::uint32_t previous = table_[(n - coins_[i]) * stride_ + k];
+                if (previous != unpayable && previous + 1 < best) {
+                    best = previous + 1;
+                    best_coin = i;
+                }
+            }
+            current[k] = best;
+            if (best == unpayable)
+                continue;
+            const std::uint32_t* from = table_.data() + (n - coins_[best_coin]) * stride_;
+            std::copy(from, from + k, current);
+            ++current[best_coin];
+        }
+
+        // from bound + largest on greedy and the table both add one largest coin per largest,
+        // so greedy is optimal everywhere if it is optimal on the table
+        std::vector<std::uint32_t> greedy(rows, 0);
+        std::size_t fitting{k};
+        for (std::size_t n{1}; n < rows; n++) {
+            while (fitting > 0 && coins_[fitting - 1] <= n)
+                --fitting;
+            const std::uint32_t previous = fitting < k ? greedy[n - coins_[fitting]] : unpayable;
+            greedy[n] = previous == unpayable ? unpayable : previous + 1;
+            if (greedy[n] != table_[n * stride_ + k]) {
+                counterexample_ = static_cast<std::uint32_t>(n);
+                break;
+            }
+        }
+        if (!counterexample_) {
+            // greedy takes amount / largest largest coins, the rest is below largest
+            bound_ = 0;
+            table_.resize(static_cast<std::size_t>(largest) * stride_);
+            table_.shrink_to_fit();
+        }
+    }
+
+    namespace {
+        /**
+         * The rows of amounts copied to counts, with the extra largest coins. K coins, 0 for any number
+         */
+        template<std::size_t K, typename Extra, typename Row>
+        std::size_t copy_rows(std::span<const std::uint32_t> amounts, std::uint32_t* out, std::size_t k,
+                              Extra extra, Row row) {
+            if constexpr (K != 0)
+                k = K;
+            // no branch per amount: the largest coins of an unpayable row are multiplied by 0
+            std::size_t failed{0};
+            for (const std::uint32_t amount: amounts) {
+                const std::uint32_t e = extra(amount);
+                const std::uint32_t* r = row(amount, e);
+                const std::uint32_t payable = r[k] != unpayable;
+                out[0] = r[0] + e * payable;
+                for (std::size_t i{1}; i < k; i++)
+                    out[i] = r[i];
+                failed += 1 - payable;
+                out += k;
+            }
+            return failed;
+        }
+    }
+
+    bool CoinSystem::make_change(std::uint32_t amount, std::span<std::uint32_t> counts) const {
+        if (counts.size() != coins_.size())
+            throw std::invalid_argument{"CoinSystem::make_change: needs size() counts"};
+        return change_rows(std::span<const std::uint32_t>{&amount, 1}, counts.data()) == 0;
+    }
+
+    std::size_t CoinSystem::make_change(std::span<const std::uint32_t> amounts, std::span<std::uint32_t> counts,
+                                        unsigned threads) const {
+        const std::size_t k = coins_.size();
+        if (counts.size() != amounts.size() * k)
+            throw std::invalid_argument{"CoinSystem::make_change: needs size() counts per amount"};
+        // every thread reads the same table and writes its own rows of counts
+        std::atomic<std::size_t> failed{0};
+        const auto parts = parallel::threads_for(amounts.size(), threads, parallel_threshold);
+        parallel::split(amounts.size(), parts, [&](unsigned, std::size_t first, std::size_t last) {
+            failed += change_rows(amounts.subspan(first, last - first), counts.data() + first * k);
+        });
+        return failed;
+    }
+
+    void CoinSystem::count_coins(std::span<const std::uint32_t> amounts, std::span<std::uint32_t> totals,
+                                 unsigned threads) const {
+        if (totals.size() != amounts.size())
+            throw std::invalid_argument{"CoinSystem::count_coins: needs one total per amount"};
+        const auto parts = parallel::threads_for(amounts.size(), threads, parallel_threshold);
+        parallel::split(amounts.size(), parts, [&](unsigned, std::size_t first, std::size_t last) {
+            count_rows(amounts.subspan(first, last - first), totals.data() + first);
+        });
+    }
+
+    std::size_t CoinSystem::change_rows(std::span<const std::uint32_t> amounts, std::uint32_t* out) const {
+        const std::size_t k = coins_.size();
+        const auto extra = [this](std::uint32_t amount) { return this->extra(amount); };
+        const auto row = [this](std::uint32_t amount, std::uint32_t e) { return this->row(amount, e); };
+        // a fixed number of coins turns the copy of a row into a few moves
+        switch (k) {
+            case 1:
+                return copy_rows<1>(amounts, out, k, extra, row);
+            case 2:
+                return copy_rows<2>(amounts, out, k, extra, row);
+            case 3:
+                return copy_rows<3>(amounts, out, k, extra, row);
+            case 4:
+                return copy_rows<4>(amounts, out, k, extra, row);
+            case 5:
+                return copy_rows<5>(amounts, out, k, extra, row);
+            case 6:
+                return copy_rows<6>(amounts, out, k, extra, row);
+            default:
+                return copy_rows<0>(amounts, out, k, extra, row);
+        }
+    }
+
+    void CoinSystem::count_rows(std::span<const std::uint32_t> amounts, std::uint32_t* out) const {
+        const std::size_t k = coins_.size();
+        for (std::size_t i{0}; i < amounts.size(); i++) {
+            const std::uint32_t e = extra(amounts[i]);
+            const std::uint32_t total = row(amounts[i], e)[k];
+            out[i] = total + e * (total != unpayable);
+        }
+    }
+
+    const CoinSystem& us_coins() {
+        static const CoinSystem coins{{100, 25, 10, 5, 1}};
+        return coins;
+    }
+}
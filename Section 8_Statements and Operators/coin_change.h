@@ -0,0 +1,128 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_8_STATEMENTS_AND_OPERATORS_COIN_CHANGE_H
+#define SECTION_8_STATEMENTS_AND_OPERATORS_COIN_CHANGE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace change {
+    /**
+     * Count written by count_coins for an amount the coins can not pay (no 1 cent coin)
+     */
+    constexpr std::uint32_t unpayable{std::numeric_limits<std::uint32_t>::max()};
+
+    /**
+     * Batches from this size on are split between threads with threads = 0
+     */
+    constexpr std::size_t parallel_threshold{1 << 20};
+
+    /**
+     * The fewest coins for any amount, for any set of coins.
+     *
+     * An optimal payment never holds lcm(c, largest) / c or more coins c of a smaller coin:
+     * the same value in largest coins is fewer coins. So from bound = sum(lcm(c, largest) - c) on,
+     * the best payment of an amount is the best payment of amount - largest plus one largest coin.
+     * A DP table of the amounts below bound + largest answers every amount with one division and one row:
+     *
+     *   extra = (max(amount, bound) - bound) / largest      largest coins on top of the row
+     *   row   = table[amount - extra * largest]
+     *
+     * The coins do not need to be canonical: for 4/3/1 the change of 6 is 3 + 3,
+     * where the Section 8 chain of divisions gives 4 + 1 + 1.
+     *
+     * When greedy is optimal for every amount (canonical coins, like 100/25/10/5/1) the table only keeps
+     * the amounts below largest and bound is 0: 100 rows instead of 459 for the US coins.
+     * The table is never written after the constructor, any number of threads can query one CoinSystem.
+     */
+    class CoinSystem {
+    public:
+        /**
+         * Distinct coins above 0, in any order. std::invalid_argument otherwise,
+         * std::length_error if the table would need more than max_rows rows
+         */
+        explicit CoinSystem(std::vector<std::uint32_t> coins, std::size_t max_rows = 1 << 24);
+
+        /**
+         * Largest first, the order of every row of counts
+         */
+        const std::vector<std::uint32_t>& coins() const { return coins_; }
+
+        std::size_t size() const { return coins_.size(); }
+
+        std::size_t table_rows() const { return table_.size() / stride_; }
+
+        /**
+         * True if taking the largest coin that fits, again and again, is optimal for every amount
+         */
+        bool canonical() const { return !counterexample_; }
+
+        /**
+         * The smallest amount greedy pays with more coins than needed (or can not pay), none if canonical
+         */
+        std::optional<std::uint32_t> greedy_counterexample() const { return counterexample_; }
+
+        /**
+         * size() counts for amount, all 0 and false if it can not be paid
+         */
+        bool make_change(std::uint32_t amount, std::span<std::uint32_t> counts) const;
+
+        /**
+         * size() counts per amount, row after row. Returns how many amounts could not be paid
+         */
+        std::size_t make_change(std::span<const std::uint32_t> amounts, std::span<std::uint32_t> counts,
+                                unsigned threads = 0) const;
+
+        /**
+         * The number of coins of every amount, unpayable for the ones that can not be paid
+         */
+        void count_coins(std::span<const std::uint32_t> amounts, std::span<std::uint32_t> totals,
+                         unsigned threads = 0) const;
+
+    private:
+        std::size_t change_rows(std::span<const std::uint32_t> amounts, std::uint32_t* out) const;
+
+        void count_rows(std::span<const std::uint32_t> amounts, std::uint32_t* out) const;
+
+        /**
+         * Largest coins paid on top of the table row of amount
+         */
+        std::uint32_t extra(std::uint32_t amount) const {
+            const std::uint32_t above = std::max(amount, bound_) - bound_;
+#if defined(__SIZEOF_INT128__)
+            // a / largest as a multiplication, exact for 32-bit a (Lemire, Kaser and Kurz); largest 1 has no magic
+            if (magic_ != 0)
+                return static_cast<std::uint32_t>((static_cast<unsigned __int128>(magic_) * above) >> 64);
+#endif
+            return above / coins_[0];
+        }
+
+        /**
+         * size() counts and the total
+         */
+        const std::uint32_t* row(std::uint32_t amount, std::uint32_t extra) const {
+            return table_.data() + static_cast<std::size_t>(amount - extra * coins_[0]) * stride_;
+        }
+
+        std::vector<std::uint32_t> coins_;
+        std::uint32_t bound_{0};
+        std::uint64_t magic_{0};
+        std::size_t stride_{0};
+        std::vector<std::uint32_t> table_;
+        std::optional<std::uint32_t> counterexample_;
+    };
+
+    /**
+     * 100/25/10/5/1, the coins of the Section 8 challenge
+     */
+    const CoinSystem& us_coins();
+}
+
+#endif //SECTION_8_STATEMENTS_AND_OPERATORS_COIN_CHANGE_H
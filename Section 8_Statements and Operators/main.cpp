@@ -1,4 +1,8 @@
+#include <cstdint>
 #include <iostream>
+#include <vector>
+
+#include "coin_change.h"
 
 using namespace std;
 
@@ -99,6 +103,7 @@ int main() {
     cin >> number_of_cents;
 
     cents = number_of_cents;
+    const long amount{number_of_cents};
 
     num_dollar = number_of_cents / dollar;
     number_of_cents -= dollar * num_dollar;
@@ -156,6 +161,41 @@ int main() {
          << (dollar * num_dollar + quarter * num_quarter + dime * num_dime + nickel * num_nickel + penny * num_penny)
          << " , Left: " << (cents - num_penny) << endl << endl;
 
+    cout << "Using the change table" << endl;
+
+    // one table lookup per amount instead of a division per coin, for any set of coins
+    const change::CoinSystem& us_coins = change::us_coins();
+    std::vector<std::uint32_t> coin_counts(us_coins.size());
+    if (amount >= 0 && us_coins.make_change(static_cast<std::uint32_t>(amount), coin_counts)) {
+        const char* coin_names[]{"Dollar", "Quarter", "Dime", "Nickel", "Pennies"};
+        cout << "You can provide change as follows: " << endl;
+        for (std::size_t i{0}; i < coin_counts.size(); i++)
+            cout << coin_names[i] << ": " << coin_counts[i] << endl;
+    }
+
+    // a whole batch of payouts in one call
+    const std::vector<std::uint32_t> payouts{1999, 250, 41, 7};
+    std::vector<std::uint32_t> payout_coins(payouts.size());
+    us_coins.count_coins(payouts, payout_coins);
+    cout << "\nCoins needed per payout:";
+    for (std::size_t i{0}; i < payouts.size(); i++)
+        cout << " " << payouts[i] << " -> " << payout_coins[i];
+    cout << endl << endl;
+
+    // greedy is only right for canonical coins: the old British half crown, florin, shilling, sixpence, threepence and penny
+    const change::CoinSystem old_pence{{30, 24, 12, 6, 3, 1}};
+    cout << std::boolalpha << "US coins canonical: " << us_coins.canonical()
+         << ", old British coins canonical: " << old_pence.canonical() << std::noboolalpha << endl;
+    if (auto pence = old_pence.greedy_counterexample()) {
+        std::vector<std::uint32_t> pence_counts(old_pence.size());
+        old_pence.make_change(*pence, pence_counts);
+        cout << "Greedy pays " << *pence << " pence with more coins than needed, the best is:";
+        for (std::size_t i{0}; i < pence_counts.size(); i++)
+            if (pence_counts[i] > 0)
+                cout << " " << pence_counts[i] << " x " << old_pence.coins()[i];
+        cout << endl << endl;
+    }
+
 
     return 0;
 }
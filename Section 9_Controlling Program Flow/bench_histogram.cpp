@@ -0,0 +1,81 @@
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "benchmark.h"
+#include "buffered_writer.h"
+#include "histogram.h"
+
+/**
+ * Bars of 1 to 10,000 characters written to the null device, items are characters.
+ * The stream version of Section 9 runs on 10K rows, at one insertion per character
+ * 1M rows (5 billion insertions) would take minutes.
+ */
+namespace {
+#ifdef _WIN32
+    constexpr const char* null_device{"NUL"};
+#else
+    constexpr const char* null_device{"/dev/null"};
+#endif
+
+    std::vector<int> bar_lengths(std::size_t rows) {
+        std::vector<int> values(rows);
+        std::uint64_t state{42};
+        for (auto& value: values) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            value = 1 + static_cast<int>((state >> 32) % 10'000);
+        }
+        return values;
+    }
+
+    long long characters(const std::vector<int>& values) {
+        long long total{0};
+        for (int value: values)
+            total += value + 1;
+        return total;
+    }
+}
+
+void bm_histogram_stream(bench::State& state) {
+    const auto data = bar_lengths(state.range(0));
+    std::ofstream out{null_device};
+    while (state.keep_running()) {
+        for (auto val: data) {
+            for (int i{0}; i < val; i++) {
+                if (i % 5 != 0)
+                    out << "-";
+                else
+                    out << "*";
+            }
+            out << std::endl;
+        }
+    }
+    state.set_bytes_processed(state.iterations() * characters(data));
+}
+BENCHMARK(bm_histogram_stream)->arg(10'000)->iterations(1);
+
+void bm_histogram_render(bench::State& state) {
+    const auto data = bar_lengths(state.range(0));
+    std::FILE* file = std::fopen(null_device, "wb");
+    while (state.keep_running()) {
+        BufferedWriter out{file, 1 << 20};
+        histogram::render_bars(out, data);
+    }
+    std::fclose(file);
+    state.set_bytes_processed(state.iterations() * characters(data));
+}
+BENCHMARK(bm_histogram_render)->arg(10'000)->arg(1'000'000)->iterations(1);
+
+void bm_histogram_bin(bench::State& state) {
+    // 100M bar lengths into 100 bins
+    const auto data = bar_lengths(state.range(0));
+    const auto threads = static_cast<unsigned>(state.range(1));
+    while (state.keep_running()) {
+        auto bins = histogram::bin_values(data, 0, 10'001, 100, threads);
+        bench::do_not_optimize(bins.counts.data());
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+}
+BENCHMARK(bm_histogram_bin)->args({100'000'000, 1})->args({100'000'000, 4});
@@ -0,0 +1,66 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+#include "benchmark.h"
+#include "buffered_writer.h"
+#include "number_reader.h"
+
+/**
+ * range(0) numbers, an int and a double per line ("48213 1205.25"), written once to a temp file
+ */
+std::filesystem::path numbers_file(long long count) {
+    static std::filesystem::path path;
+    static long long written{0};
+    if (written != count) {
+        path = std::filesystem::temp_directory_path() / "section_9_numbers.txt";
+        std::FILE* file = std::fopen(path.string().c_str(), "wb");
+        {
+            BufferedWriter out{file};
+            out.set_precision(-1);
+            for (long long i{0}; i < count / 2; i++)
+                out << (i * 7919) % 1000003 << ' ' << static_cast<double>(i % 100000) * 0.25 << '\n';
+        }
+        std::fclose(file);
+        written = count;
+        std::atexit([] { std::filesystem::remove(path); });
+    }
+    return path;
+}
+
+void bm_ifstream_extract(bench::State& state) {
+    const auto path = numbers_file(state.range(0));
+    long long numbers{0};
+    while (state.keep_running()) {
+        std::ifstream in{path};
+        int id{};
+        double amount{};
+        double sum{0};
+        while (in >> id >> amount) {
+            sum += id + amount;
+            numbers += 2;
+        }
+        bench::do_not_optimize(sum);
+    }
+    state.set_items_processed(numbers);
+}
+BENCHMARK(bm_ifstream_extract)->arg(100'000'000)->iterations(1);
+
+void bm_number_reader(bench::State& state) {
+    const auto path = numbers_file(state.range(0));
+    long long numbers{0};
+    while (state.keep_running()) {
+        FileReader file{path.string()};
+        NumberReader in{file};
+        int id{};
+        double amount{};
+        double sum{0};
+        while (in.read(id) && in.read(amount)) {
+            sum += id + amount;
+            numbers += 2;
+        }
+        bench::do_not_optimize(sum);
+    }
+    state.set_items_processed(numbers);
+}
+BENCHMARK(bm_number_reader)->arg(100'000'000)->iterations(1);
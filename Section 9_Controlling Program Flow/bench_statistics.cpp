@@ -0,0 +1,148 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "benchmark.h"
+#include "statistics.h"
+
+/**
+ * Temperatures (doubles) and scores (ints) of range(0) values.
+ * Doubles stop at 100M (800 MB), ints go up to 1B (4 GB): 1B doubles would not fit in memory here.
+ */
+namespace {
+    std::uint64_t next(std::uint64_t& state) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    /**
+     * Only the last data set asked for is kept
+     */
+    std::vector<double> temperature_values;
+    std::vector<int> score_values;
+
+    const std::vector<double>& temperatures(std::size_t n) {
+        auto& values = temperature_values;
+        if (values.size() != n) {
+            score_values = {};
+            values = {};
+            values.resize(n);
+            std::uint64_t state{42};
+            for (auto& value: values)
+                value = 40.0 + static_cast<double>(next(state) >> 11) * 0x1.0p-53 * 70.0;
+        }
+        return values;
+    }
+
+    const std::vector<int>& scores(std::size_t n) {
+        auto& values = score_values;
+        if (values.size() != n) {
+            temperature_values = {};
+            values = {};
+            values.resize(n);
+            std::uint64_t state{42};
+            for (auto& value: values)
+                value = static_cast<int>((next(state) >> 32) % 101);
+        }
+        return values;
+    }
+}
+
+void bm_naive_sum(bench::State& state) {
+    const auto& values = temperatures(state.range(0));
+    while (state.keep_running()) {
+        double running_sum{};
+        for (auto temp: values)
+            running_sum += temp;
+        bench::do_not_optimize(running_sum);
+    }
+    state.set_items_processed(state.iterations() * values.size());
+}
+BENCHMARK(bm_naive_sum)->arg(1'000)->arg(1'000'000)->arg(100'000'000);
+
+void bm_stats_sum(bench::State& state) {
+    const auto& values = temperatures(state.range(0));
+    while (state.keep_running())
+        bench::do_not_optimize(stats::sum(values));
+    state.set_items_processed(state.iterations() * values.size());
+}
+BENCHMARK(bm_stats_sum)->arg(1'000)->arg(1'000'000)->arg(100'000'000);
+
+void bm_stats_kahan_sum(bench::State& state) {
+    const auto& values = temperatures(state.range(0));
+    while (state.keep_running())
+        bench::do_not_optimize(stats::kahan_sum(values));
+    state.set_items_processed(state.iterations() * values.size());
+}
+BENCHMARK(bm_stats_kahan_sum)->arg(1'000)->arg(1'000'000)->arg(100'000'000);
+
+void bm_naive_summary(bench::State& state) {
+    // the loop one would write: running sums, min, max, then the variance from the sums
+    const auto& values = temperatures(state.range(0));
+    while (state.keep_running()) {
+        double running_sum{}, squares{};
+        double low{std::numeric_limits<double>::infinity()}, high{-low};
+        for (auto temp: values) {
+            running_sum += temp;
+            squares += temp * temp;
+            if (temp < low)
+                low = temp;
+            if (temp > high)
+                high = temp;
+        }
+        const double n = static_cast<double>(values.size());
+        const double variance = (squares - running_sum * running_sum / n) / (n - 1);
+        bench::do_not_optimize(running_sum);
+        bench::do_not_optimize(variance);
+        bench::do_not_optimize(low);
+        bench::do_not_optimize(high);
+    }
+    state.set_items_processed(state.iterations() * values.size());
+}
+BENCHMARK(bm_naive_summary)->arg(1'000)->arg(1'000'000)->arg(100'000'000);
+
+void bm_stats_summarize(bench::State& state) {
+    const auto& values = temperatures(state.range(0));
+    const auto threads = static_cast<unsigned>(state.range(1));
+    while (state.keep_running()) {
+        auto summary = stats::summarize(values, threads);
+        bench::do_not_optimize(summary);
+    }
+    state.set_items_processed(state.iterations() * values.size());
+}
+BENCHMARK(bm_stats_summarize)->args({1'000, 1})->args({1'000'000, 1})->args({100'000'000, 1})->args({100'000'000, 4});
+
+void bm_naive_score_summary(bench::State& state) {
+    const auto& values = scores(state.range(0));
+    while (state.keep_running()) {
+        long long running_sum{};
+        int low{std::numeric_limits<int>::max()}, high{std::numeric_limits<int>::min()};
+        for (auto score: values) {
+            running_sum += score;
+            if (score < low)
+                low = score;
+            if (score > high)
+                high = score;
+        }
+        bench::do_not_optimize(running_sum);
+        bench::do_not_optimize(low);
+        bench::do_not_optimize(high);
+    }
+    state.set_items_processed(state.iterations() * values.size());
+}
+BENCHMARK(bm_naive_score_summary)->arg(1'000)->arg(1'000'000)->arg(1'000'000'000)->iterations(3);
+
+void bm_stats_score_summarize(bench::State& state) {
+    const auto& values = scores(state.range(0));
+    const auto threads = static_cast<unsigned>(state.range(1));
+    while (state.keep_running()) {
+        auto summary = stats::summarize(values, threads);
+        bench::do_not_optimize(summary);
+    }
+    state.set_items_processed(state.iterations() * values.size());
+}
+BENCHMARK(bm_stats_score_summarize)->args({1'000, 1})->args({1'000'000, 1})->args({1'000'000'000, 1})
+        ->args({1'000'000'000, 4})->iterations(3);
@@ -0,0 +1,74 @@
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "benchmark.h"
+#include "statistics.h"
+#include "streaming_histogram.h"
+
+/**
+ * range(0) integers streamed from a generator, never stored: values spread over 1 to 2^30,
+ * most of them small (a random value shifted right by a random amount).
+ * Keeping them to sort (the vector version) stops at 100M values, 400 MB.
+ */
+namespace {
+    struct Stream {
+        std::uint64_t state;
+
+        std::int64_t next() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return static_cast<std::int64_t>((state >> 34) >> (state & 31));
+        }
+    };
+
+    const double reported[]{50, 90, 99, 99.9};
+}
+
+void bm_stream_vector(bench::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    while (state.keep_running()) {
+        std::vector<int> values;
+        values.reserve(n);
+        Stream stream{42};
+        for (std::size_t i{0}; i < n; i++)
+            values.push_back(static_cast<int>(stream.next()));
+        auto result = stats::percentiles(values, reported);
+        bench::do_not_optimize(result.data());
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+}
+BENCHMARK(bm_stream_vector)->arg(100'000'000)->iterations(1);
+
+void bm_stream_histogram(bench::State& state) {
+    const auto n = static_cast<std::uint64_t>(state.range(0));
+    const auto threads = static_cast<unsigned>(state.range(1));
+    histogram::StreamingHistogram total;
+    while (state.keep_running()) {
+        // one histogram and one part of the stream per thread, merged at the end
+        std::vector<histogram::StreamingHistogram> parts(threads);
+        std::vector<std::thread> workers;
+        for (unsigned t{0}; t < threads; t++) {
+            workers.emplace_back([&parts, t, n, threads] {
+                Stream stream{42 + t};
+                const auto count = n / threads + (t < n % threads ? 1 : 0);
+                for (std::uint64_t i{0}; i < count; i++)
+                    parts[t].record(stream.next());
+            });
+        }
+        for (auto& worker: workers)
+            worker.join();
+        total.clear();
+        for (const auto& part: parts)
+            total.merge(part);
+        bench::do_not_optimize(total.percentile(99));
+    }
+    state.set_items_processed(state.iterations() * state.range(0));
+    state.set_counter("bytes", static_cast<double>(total.memory() * threads));
+}
+BENCHMARK(bm_stream_histogram)
+        ->args({100'000'000, 1})
+        ->args({10'000'000'000, 1})
+        ->args({10'000'000'000, 4})
+        ->iterations(1);
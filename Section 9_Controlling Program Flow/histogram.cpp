@@ -0,0 +1,103 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "histogram.h"
+
+#include <stdexcept>
+
+#include "parallel.h"
+
+namespace histogram {
+    namespace {
+        template<typename T>
+        void count_range(const T* values, std::size_t n, double min, double scale, Bins& bins) {
+            const auto bin_count = bins.counts.size();
+            for (std::size_t i{0}; i < n; i++) {
+                const double position = (static_cast<double>(values[i]) - min) * scale;
+                // negated so that NaN lands here instead of in a cast to size_t
+                if (!(position >= 0)) {
+                    ++bins.underflow;
+                } else if (position >= static_cast<double>(bin_count)) {
+                    ++bins.overflow;
+                } else {
+                    ++bins.counts[static_cast<std::size_t>(position)];
+                }
+            }
+        }
+
+        template<typename T>
+        Bins bin(std::span<const T> values, double min, double max, std::size_t bin_count, unsigned threads) {
+            if (bin_count == 0 || !(max > min))
+                throw std::invalid_argument{"histogram::bin_values: needs bins and max > min"};
+            Bins result;
+            result.min = min;
+            result.width = (max - min) / static_cast<double>(bin_count);
+            result.counts.assign(bin_count, 0);
+            const double scale = static_cast<double>(bin_count) / (max - min);
+            const auto parts = parallel::threads_for(values.size(), threads, parallel_threshold);
+            if (parts == 1) {
+                count_range(values.data(), values.size(), min, scale, result);
+                return result;
+            }
+
+            // private counts per thread, no sharing of cache lines while counting
+            std::vector<Bins> partials(parts, result);
+            parallel::split(values.size(), parts, [&](unsigned part, std::size_t first, std::size_t last) {
+                count_range(values.data() + first, last - first, min, scale, partials[part]);
+            });
+            for (const auto& partial: partials) {
+                for (std::size_t b{0}; b < bin_count; b++)
+                    result.counts[b] += partial.counts[b];
+                result.underflow += partial.underflow;
+                result.overflow += partial.overflow;
+            }
+            return result;
+        }
+    }
+
+    Bins bin_values(std::span<const double> values, double min, double max, std::size_t bins, unsigned threads) {
+        return bin(values, min, max, bins, threads);
+    }
+
+    Bins bin_values(std::span<const int> values, double min, double max, std::size_t bins, unsigned threads) {
+        return bin(values, min, max, bins, threads);
+    }
+
+    std::string bar_run(std::size_t length) {
+        std::string run(length, '-');
+        for (std::size_t i{0}; i < length; i += 5)
+            run[i] = '*';
+        return run;
+    }
+
+    void render_bars(BufferedWriter& out, std::span<const int> values) {
+        int longest{0};
+        for (int value: values)
+            longest = std::max(longest, value);
+        const std::string run = bar_run(static_cast<std::size_t>(longest));
+        for (int value: values) {
+            if (value > 0)
+                out.write(run.data(), static_cast<std::size_t>(value));
+            out << '\n';
+        }
+    }
+
+    void render_bins(BufferedWriter& out, const Bins& bins, std::size_t max_width) {
+        std::uint64_t largest{0};
+        for (auto count: bins.counts)
+            largest = std::max(largest, count);
+        const std::string run = bar_run(max_width);
+        const FieldSpec bound{10, ' ', Align::Right, 4};
+        const FieldSpec count{12};
+        for (std::size_t b{0}; b < bins.counts.size(); b++) {
+            const double low = bins.min + bins.width * static_cast<double>(b);
+            out << '[';
+            out.write_field(low, bound) << ", ";
+            out.write_field(low + bins.width, bound) << ')';
+            out.write_field(static_cast<long long>(bins.counts[b]), count) << ' ';
+            const auto length = largest == 0 ? 0 : static_cast<std::size_t>(bins.counts[b] * max_width / largest);
+            out.write(run.data(), length) << '\n';
+        }
+    }
+}
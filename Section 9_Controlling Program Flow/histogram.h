@@ -0,0 +1,63 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_9_CONTROLLING_PROGRAM_FLOW_HISTOGRAM_H
+#define SECTION_9_CONTROLLING_PROGRAM_FLOW_HISTOGRAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "buffered_writer.h"
+
+/**
+ * Binning large data sets and drawing them as text bars.
+ *
+ * The bars are the ones of Section 9: one character per unit, '*' every 5th ("*----*----*").
+ * Every bar is a prefix of one pre-built run, so a row is one copy into the output buffer
+ * instead of a stream insertion per character.
+ */
+namespace histogram {
+    /**
+     * Inputs from this size on are split between threads by bin_values with threads = 0
+     */
+    constexpr std::size_t parallel_threshold{1 << 22};
+
+    struct Bins {
+        double min{0};
+        double width{1};
+        std::vector<std::uint64_t> counts;
+        /**
+         * Values below min (and NaN) / at or above min + width * counts.size()
+         */
+        std::uint64_t underflow{0};
+        std::uint64_t overflow{0};
+    };
+
+    /**
+     * Counts the values of [min, max) in bins of equal width, every thread counts its part on its own
+     */
+    Bins bin_values(std::span<const double> values, double min, double max, std::size_t bins, unsigned threads = 0);
+
+    Bins bin_values(std::span<const int> values, double min, double max, std::size_t bins, unsigned threads = 0);
+
+    /**
+     * "*----*----" of the given length, the run every bar is cut from
+     */
+    std::string bar_run(std::size_t length);
+
+    /**
+     * One bar per value, value characters long
+     */
+    void render_bars(BufferedWriter& out, std::span<const int> values);
+
+    /**
+     * One row per bin: its range, its count and a bar scaled so the largest bin is max_width long
+     */
+    void render_bins(BufferedWriter& out, const Bins& bins, std::size_t max_width = 60);
+}
+
+#endif //SECTION_9_CONTROLLING_PROGRAM_FLOW_HISTOGRAM_H
@@ -1,10 +1,16 @@
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <vector>
 
+#include "histogram.h"
+#include "number_reader.h"
+#include "statistics.h"
+#include "streaming_histogram.h"
+
 
 using std::cout;
-using std::cin;
+using std::cerr;
 using std::endl;
 using std::setprecision;
 using std::fixed;
@@ -12,6 +18,15 @@ using std::fixed;
 int main() {
     std::cout << "Hello, World!" << std::endl;
 
+    // every input below is read with NumberReader instead of cin >>
+    FileReader console{0};
+    NumberReader input{console};
+    input.tie(&cout);
+    auto read = [&input](auto& value) {
+        if (!input.read(value))
+            cerr << "Invalid input, " << input.error() << endl;
+    };
+
     cout << "================== IF ==================" << endl << endl;
     int num{};
     int diff{};
@@ -19,7 +34,7 @@ int main() {
     const int max{100};
 
     cout << "Enter a number between " << min << " and " << max << endl;
-    cin >> num;
+    read(num);
 
     if (num >= min) {
         cout << "========== IF STATEMENT 1 =========" << endl;
@@ -54,7 +69,7 @@ int main() {
     const int target{10};
 
     cout << "Enter a number and I'll compare it to " << target << endl;
-    cin >> num;
+    read(num);
 
     if (num >= target) {
         cout << "\n=======================================================" << endl;
@@ -72,7 +87,7 @@ int main() {
 
     int score{};
     cout << "Enter your score on the exam (0-100) " << endl;
-    cin >> score;
+    read(score);
     char letter_grade{};
 
     if (score >= 0 && score <= 100) {
@@ -108,7 +123,9 @@ int main() {
 
     cout << "Welcome to the Shipping cost calculator" << endl;
     cout << "Please enter the dimensions of your package [length width height]" << endl;
-    cin >> length >> width >> height;
+    read(length);
+    read(width);
+    read(height);
 
     if (length >= max_size || width >= max_size || height >= max_size) {
         if (length < max_size) {
@@ -139,7 +156,7 @@ int main() {
 
     letter_grade = 'N';
     cout << "Enter the letter grade you expect on the exam: ";
-    cin >> letter_grade;
+    read(letter_grade);
 
     switch (letter_grade) {
         case 'a':
@@ -162,7 +179,7 @@ int main() {
         case 'F': {
             char confirm{};
             cout << "Are you sure? (Y/N)";
-            cin >> confirm;
+            read(confirm);
             if (confirm == 'y' || confirm == 'Y') {
                 cout << "It seems you don want to study..." << endl;
             } else if (confirm == 'n' || confirm == 'N') {
@@ -238,6 +255,13 @@ int main() {
     }
     average_temp = running_sum / temperatures.size();
 
+    // the same average, and the rest of the statistics, from one call
+    stats::Summary temp_stats = stats::summarize(temperatures);
+    cout << "Average temperature " << average_temp << " (summarize: " << temp_stats.mean
+         << ", min " << temp_stats.min << ", max " << temp_stats.max
+         << ", variance " << temp_stats.variance
+         << ", median " << stats::percentile(temperatures, 50) << ")" << endl;
+
     for (auto temp : {60.2, 50.0, 45.0, 89.9, 100.5}) {
         cout << temp << endl;
     }
@@ -267,28 +291,47 @@ int main() {
     int num_items{};
 
     cout << "How many data items do you have? ";
-    cin >> num_items;
+    read(num_items);
 
     std::vector<int> data{};
+    // one allocation up front instead of one every time push_back runs out of room,
+    // capped so that a mistyped count does not reserve gigabytes before the first item is read
+    if (num_items > 0)
+        data.reserve(std::min<std::size_t>(static_cast<std::size_t>(num_items), 1 << 16));
 
+    // the bars need every item, the percentiles only need the counts of the streaming histogram
+    histogram::StreamingHistogram data_counts;
     for (int i{1}; i <= num_items; i++) {
         int data_item{};
         cout << "Enter data item " << i << ": ";
-        cin >> data_item;
+        read(data_item);
         data.push_back(data_item);
+        data_counts.record(data_item);
     }
 
     cout << "Displaying Histogram " << endl;
-    for (auto val : data) {
-        for (int i{0}; i < val; i++) {
-            if (i % 5 != 0)
-                cout << "-";
-            else
-                cout << "*";
-        }
-        cout << endl;
+    {
+        // every bar is copied from one pre-built "*----*----" run into the buffer, one write at the end
+        BufferedWriter out;
+        histogram::render_bars(out, data);
+    }
+
+    cout << "\nThe data items in 4 bins" << endl;
+    if (!data.empty()) {
+        BufferedWriter out;
+        // the range is worked out in double, the largest item + 1 does not overflow at INT_MAX
+        const auto [lowest, highest] = std::minmax_element(data.begin(), data.end());
+        histogram::render_bins(out, histogram::bin_values(data, *lowest, static_cast<double>(*highest) + 1, 4), 20);
     }
 
+    // the streaming histogram only keeps items >= 0, say how many it left out
+    if (data_counts.count() > 0)
+        cout << "Median " << data_counts.percentile(50) << ", 90th percentile " << data_counts.percentile(90)
+             << ", largest " << data_counts.max() << " of the " << data_counts.count() << " items >= 0 ("
+             << data_counts.memory() << " bytes for any number of items)" << endl;
+    if (data_counts.negative() > 0)
+        cout << data_counts.negative() << " negative items are not part of the percentiles" << endl;
+
 
     system("pause");
 
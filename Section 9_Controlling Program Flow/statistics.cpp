@@ -0,0 +1,283 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "statistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "parallel.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define STATS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace stats {
+    namespace {
+        constexpr std::size_t lanes{8};
+        // leaves of the pairwise sum, small enough that their rounding error does not matter
+        constexpr std::size_t pairwise_block{1024};
+
+        template<typename T>
+        double block_sum(const T* values, std::size_t n) {
+            double acc[lanes]{};
+            std::size_t i{0};
+            for (; i + lanes <= n; i += lanes)
+                for (std::size_t l{0}; l < lanes; l++)
+                    acc[l] += static_cast<double>(values[i + l]);
+            double total{0};
+            for (; i < n; i++)
+                total += static_cast<double>(values[i]);
+            return total + ((acc[0] + acc[1]) + (acc[2] + acc[3])) + ((acc[4] + acc[5]) + (acc[6] + acc[7]));
+        }
+
+        double pairwise(const double* values, std::size_t n) {
+            if (n <= pairwise_block)
+                return block_sum(values, n);
+            const std::size_t half = (n / 2 + lanes - 1) / lanes * lanes;
+            return pairwise(values, half) + pairwise(values + half, n - half);
+        }
+
+        /**
+         * Partial results of a chunk. The values are shifted by a common value close to the mean,
+         * which keeps sum of squares minus square of sums from cancelling out.
+         */
+        struct Partial {
+            std::size_t count{0};
+            double shifted_sum{0};
+            double shifted_squares{0};
+            double min{std::numeric_limits<double>::infinity()};
+            double max{-std::numeric_limits<double>::infinity()};
+
+            void add(const Partial& other) {
+                count += other.count;
+                shifted_sum += other.shifted_sum;
+                shifted_squares += other.shifted_squares;
+                min = std::min(min, other.min);
+                max = std::max(max, other.max);
+            }
+        };
+
+#ifdef STATS_SSE2
+        __m128d load_pair(const double* values) { return _mm_loadu_pd(values); }
+
+        __m128d load_pair(const int* values) {
+            return _mm_cvtepi32_pd(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values)));
+        }
+
+        double horizontal_sum(__m128d v) {
+            return _mm_cvtsd_f64(v) + _mm_cvtsd_f64(_mm_unpackhi_pd(v, v));
+        }
+#endif
+
+        template<typename T>
+        Partial block_partial(const T* values, std::size_t n, double shift) {
+            Partial result;
+            result.count = n;
+            std::size_t i{0};
+#ifdef STATS_SSE2
+            // the 8 lanes as 4 pairs, the compiler does not vectorize min / max next to the sums by itself
+            const __m128d shift_pair = _mm_set1_pd(shift);
+            __m128d sum[4], squares[4], low[4], high[4];
+            for (int k{0}; k < 4; k++) {
+                sum[k] = squares[k] = _mm_setzero_pd();
+                low[k] = _mm_set1_pd(std::numeric_limits<double>::infinity());
+                high[k] = _mm_set1_pd(-std::numeric_limits<double>::infinity());
+            }
+            for (; i + lanes <= n; i += lanes) {
+                for (int k{0}; k < 4; k++) {
+                    const __m128d x = load_pair(values + i + 2 * k);
+                    const __m128d d = _mm_sub_pd(x, shift_pair);
+                    sum[k] = _mm_add_pd(sum[k], d);
+                    squares[k] = _mm_add_pd(squares[k], _mm_mul_pd(d, d));
+                    low[k] = _mm_min_pd(low[k], x);
+                    high[k] = _mm_max_pd(high[k], x);
+                }
+            }
+            result.shifted_sum = horizontal_sum(_mm_add_pd(_mm_add_pd(sum[0], sum[1]), _mm_add_pd(sum[2], sum[3])));
+            result.shifted_squares = horizontal_sum(
+                    _mm_add_pd(_mm_add_pd(squares[0], squares[1]), _mm_add_pd(squares[2], squares[3])));
+            const __m128d lowest = _mm_min_pd(_mm_min_pd(low[0], low[1]), _mm_min_pd(low[2], low[3]));
+            const __m128d highest = _mm_max_pd(_mm_max_pd(high[0], high[1]), _mm_max_pd(high[2], high[3]));
+            result.min = std::min(_mm_cvtsd_f64(lowest), _mm_cvtsd_f64(_mm_unpackhi_pd(lowest, lowest)));
+            result.max = std::max(_mm_cvtsd_f64(highest), _mm_cvtsd_f64(_mm_unpackhi_pd(highest, highest)));
+#else
+            double sum[lanes]{}, squares[lanes]{};
+            double low[lanes], high[lanes];
+            std::fill(low, low + lanes, std::numeric_limits<double>::infinity());
+            std::fill(high, high + lanes, -std::numeric_limits<double>::infinity());
+            for (; i + lanes <= n; i += lanes) {
+                for (std::size_t l{0}; l < lanes; l++) {
+                    const double x = static_cast<double>(values[i + l]);
+                    const double d = x - shift;
+                    sum[l] += d;
+                    squares[l] += d * d;
+                    low[l] = low[l] < x ? low[l] : x;
+                    high[l] = high[l] > x ? high[l] : x;
+                }
+            }
+            for (std::size_t l{0}; l < lanes; l++) {
+                result.shifted_sum += sum[l];
+                result.shifted_squares += squares[l];
+                result.min = std::min(result.min, low[l]);
+                result.max = std::max(result.max, high[l]);
+            }
+#endif
+            for (; i < n; i++) {
+                const double x = static_cast<double>(values[i]);
+                const double d = x - shift;
+                result.shifted_sum += d;
+                result.shifted_squares += d * d;
+                result.min = std::min(result.min, x);
+                result.max = std::max(result.max, x);
+            }
+            return result;
+        }
+
+        template<typename T>
+        Partial partial(const T* values, std::size_t n, double shift) {
+            if (n <= pairwise_block)
+                return block_partial(values, n, shift);
+            const std::size_t half = (n / 2 + lanes - 1) / lanes * lanes;
+            Partial result = partial(values, half, shift);
+            result.add(partial(values + half, n - half, shift));
+            return result;
+        }
+
+        template<typename T>
+        Summary summarize_values(std::span<const T> values, unsigned threads) {
+            Summary summary;
+            if (values.empty())
+                return summary;
+            const auto parts = parallel::threads_for(values.size(), threads, parallel_threshold);
+            // any value of the data is a good enough shift, the mean of a few is better
+            const std::size_t sample = std::min<std::size_t>(values.size(), 64);
+            const double shift = block_sum(values.data(), sample) / static_cast<double>(sample);
+
+            Partial total;
+            if (parts == 1) {
+                total = partial(values.data(), values.size(), shift);
+            } else {
+                std::vector<Partial> partials(parts);
+                parallel::split(values.size(), parts, [&](unsigned part, std::size_t first, std::size_t last) {
+                    partials[part] = partial(values.data() + first, last - first, shift);
+                });
+                for (const auto& p: partials)
+                    total.add(p);
+            }
+
+            const auto n = static_cast<double>(total.count);
+            summary.count = total.count;
+            summary.mean = shift + total.shifted_sum / n;
+            summary.sum = summary.mean * n;
+            summary.min = total.min;
+            summary.max = total.max;
+            if (total.count > 1)
+                summary.variance = std::max(0.0, (total.shifted_squares - total.shifted_sum * total.shifted_sum / n) / (n - 1));
+            return summary;
+        }
+
+        template<typename T>
+        std::vector<double> percentiles_of(std::span<const T> values, std::span<const double> ps) {
+            if (values.empty())
+                throw std::invalid_argument{"stats::percentiles: no values"};
+            std::vector<T> copy(values.begin(), values.end());
+            std::vector<double> result;
+            result.reserve(ps.size());
+            for (double p: ps) {
+                if (!(p >= 0 && p <= 100))
+                    throw std::invalid_argument{"stats::percentiles: percentile outside 0-100"};
+                const double rank = p / 100 * static_cast<double>(copy.size() - 1);
+                const auto below = static_cast<std::size_t>(rank);
+                std::nth_element(copy.begin(), copy.begin() + below, copy.end());
+                const double low = static_cast<double>(copy[below]);
+                if (below + 1 == copy.size()) {
+                    result.push_back(low);
+                    continue;
+                }
+                // the next rank is the smallest value of the upper part
+                const double high = static_cast<double>(*std::min_element(copy.begin() + below + 1, copy.end()));
+                result.push_back(low + (high - low) * (rank - static_cast<double>(below)));
+            }
+            return result;
+        }
+    }
+
+    double sum(std::span<const double> values) {
+        return pairwise(values.data(), values.size());
+    }
+
+    std::int64_t sum(std::span<const int> values) {
+        std::int64_t acc[lanes]{};
+        std::size_t i{0};
+        for (; i + lanes <= values.size(); i += lanes)
+            for (std::size_t l{0}; l < lanes; l++)
+                acc[l] += values[i + l];
+        std::int64_t total{0};
+        for (; i < values.size(); i++)
+            total += values[i];
+        for (auto a: acc)
+            total += a;
+        return total;
+    }
+
+    double kahan_sum(std::span<const double> values) {
+        double acc[lanes]{}, compensation[lanes]{};
+        std::size_t i{0};
+        for (; i + lanes <= values.size(); i += lanes) {
+            for (std::size_t l{0}; l < lanes; l++) {
+                const double x = values[i + l];
+                const double t = acc[l] + x;
+                // Neumaier: keep what the addition lost, whichever operand was bigger
+                compensation[l] += std::fabs(acc[l]) >= std::fabs(x) ? (acc[l] - t) + x : (x - t) + acc[l];
+                acc[l] = t;
+            }
+        }
+        double total{0}, lost{0};
+        auto add = [&total, &lost](double x) {
+            const double t = total + x;
+            lost += std::fabs(total) >= std::fabs(x) ? (total - t) + x : (x - t) + total;
+            total = t;
+        };
+        for (std::size_t l{0}; l < lanes; l++) {
+            add(acc[l]);
+            add(compensation[l]);
+        }
+        for (; i < values.size(); i++)
+            add(values[i]);
+        return total + lost;
+    }
+
+    double mean(std::span<const double> values) {
+        return values.empty() ? 0.0 : sum(values) / static_cast<double>(values.size());
+    }
+
+    double mean(std::span<const int> values) {
+        return values.empty() ? 0.0 : static_cast<double>(sum(values)) / static_cast<double>(values.size());
+    }
+
+    Summary summarize(std::span<const double> values, unsigned threads) {
+        return summarize_values(values, threads);
+    }
+
+    Summary summarize(std::span<const int> values, unsigned threads) {
+        return summarize_values(values, threads);
+    }
+
+    double percentile(std::span<const double> values, double p) {
+        return percentiles_of(values, std::span<const double>{&p, 1}).front();
+    }
+
+    std::vector<double> percentiles(std::span<const double> values, std::span<const double> ps) {
+        return percentiles_of(values, ps);
+    }
+
+    std::vector<double> percentiles(std::span<const int> values, std::span<const double> ps) {
+        return percentiles_of(values, ps);
+    }
+}
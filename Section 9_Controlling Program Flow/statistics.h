@@ -0,0 +1,77 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_9_CONTROLLING_PROGRAM_FLOW_STATISTICS_H
+#define SECTION_9_CONTROLLING_PROGRAM_FLOW_STATISTICS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * Statistics over temperatures, scores, any contiguous doubles or ints.
+ *
+ * The kernels run 8 independent lanes per loop: plain loops the compiler vectorizes for the sums,
+ * SSE2 intrinsics for summarize() (with a scalar fallback on other CPUs).
+ */
+namespace stats {
+    /**
+     * Inputs from this size on are split between threads by summarize() with threads = 0
+     */
+    constexpr std::size_t parallel_threshold{1 << 22};
+
+    struct Summary {
+        std::size_t count{0};
+        double sum{0};
+        double mean{0};
+        double min{0};
+        double max{0};
+        /**
+         * Sample variance (divides by count - 1), 0 below 2 values
+         */
+        double variance{0};
+    };
+
+    /**
+     * Pairwise summation: error grows with log(n) instead of n like a running sum
+     */
+    double sum(std::span<const double> values);
+
+    /**
+     * Exact for ints
+     */
+    std::int64_t sum(std::span<const int> values);
+
+    /**
+     * Compensated (Kahan-Babuska) summation, the most accurate, about twice the work of sum()
+     */
+    double kahan_sum(std::span<const double> values);
+
+    double mean(std::span<const double> values);
+
+    double mean(std::span<const int> values);
+
+    /**
+     * count, sum, mean, min, max and variance in one pass over the values.
+     * threads = 0 picks the hardware threads for large inputs and 1 for small ones.
+     */
+    Summary summarize(std::span<const double> values, unsigned threads = 0);
+
+    Summary summarize(std::span<const int> values, unsigned threads = 0);
+
+    /**
+     * The p-th percentile (0 to 100), linear interpolation between the closest ranks
+     */
+    double percentile(std::span<const double> values, double p);
+
+    /**
+     * Several percentiles with one copy of the values, in the order of ps
+     */
+    std::vector<double> percentiles(std::span<const double> values, std::span<const double> ps);
+
+    std::vector<double> percentiles(std::span<const int> values, std::span<const double> ps);
+}
+
+#endif //SECTION_9_CONTROLLING_PROGRAM_FLOW_STATISTICS_H
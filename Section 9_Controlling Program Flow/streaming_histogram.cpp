@@ -0,0 +1,76 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "streaming_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace histogram {
+    StreamingHistogram::StreamingHistogram(unsigned bits) : bits_{bits} {
+        if (bits < 2 || bits > 16)
+            throw std::invalid_argument{"StreamingHistogram: bits must be between 2 and 16"};
+        // exact buckets up to 2^bits, then 2^(bits-1) per exponent up to 2^64
+        counts_.assign((static_cast<std::size_t>(66 - bits)) << (bits - 1), 0);
+        clear();
+    }
+
+    void StreamingHistogram::merge(const StreamingHistogram& other) {
+        if (other.bits_ != bits_)
+            throw std::invalid_argument{"StreamingHistogram::merge: the histograms use different bits"};
+        for (std::size_t i{0}; i < counts_.size(); i++)
+            counts_[i] += other.counts_[i];
+        total_ += other.total_;
+        negative_ += other.negative_;
+        sum_ += other.sum_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+
+    void StreamingHistogram::clear() {
+        std::fill(counts_.begin(), counts_.end(), 0);
+        total_ = 0;
+        negative_ = 0;
+        sum_ = 0;
+        min_ = std::numeric_limits<std::int64_t>::max();
+        max_ = std::numeric_limits<std::int64_t>::min();
+    }
+
+    std::uint64_t StreamingHistogram::lowest(std::size_t index) const {
+        const std::size_t half = std::size_t{1} << (bits_ - 1);
+        if (index < 2 * half)
+            return index;
+        const unsigned shift = static_cast<unsigned>(index / half) - 1;
+        return static_cast<std::uint64_t>(index - shift * half) << shift;
+    }
+
+    std::uint64_t StreamingHistogram::highest(std::size_t index) const {
+        if (index + 1 == counts_.size())
+            return std::numeric_limits<std::uint64_t>::max();
+        return lowest(index + 1) - 1;
+    }
+
+    std::int64_t StreamingHistogram::percentile(double p) const {
+        if (total_ == 0)
+            return 0;
+        if (p <= 0)
+            return min_;
+        if (p >= 100)
+            return max_;
+        const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(p / 100.0 * static_cast<double>(total_))));
+        std::uint64_t seen{0};
+        for (std::size_t i{0}; i < counts_.size(); i++) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                const auto low = lowest(i);
+                const auto middle = low + (highest(i) - low) / 2;
+                const auto value = static_cast<std::int64_t>(std::min(middle, static_cast<std::uint64_t>(max_)));
+                return std::max(value, min_);
+            }
+        }
+        return max_;
+    }
+}
@@ -0,0 +1,107 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_9_CONTROLLING_PROGRAM_FLOW_STREAMING_HISTOGRAM_H
+#define SECTION_9_CONTROLLING_PROGRAM_FLOW_STREAMING_HISTOGRAM_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace histogram {
+    /**
+     * Counts a stream of integers without keeping them, in the spirit of an HDR histogram.
+     *
+     * Values below 2^bits get a bucket each; above that every power of two is split into 2^(bits-1)
+     * buckets, so a bucket is never wider than 1 / 2^(bits-1) of its values (0.8% with 8 bits).
+     * The bucket count only depends on bits (59 KB with 8 bits for the whole int64 range),
+     * record() is one bit_width and one increment, two histograms with the same bits are merged by
+     * adding their counts: every thread can count its part of a stream on its own.
+     */
+    class StreamingHistogram {
+    public:
+        /**
+         * bits from 2 to 16, std::invalid_argument otherwise
+         */
+        explicit StreamingHistogram(unsigned bits = 8);
+
+        void record(std::int64_t value) {
+            record(value, 1);
+        }
+
+        void record(std::int64_t value, std::uint64_t times) {
+            if (value < 0) {
+                // a bar can not be shorter than nothing: counted, but not part of the percentiles
+                negative_ += times;
+                return;
+            }
+            counts_[index(static_cast<std::uint64_t>(value))] += times;
+            total_ += times;
+            sum_ += static_cast<double>(value) * static_cast<double>(times);
+            if (value < min_)
+                min_ = value;
+            if (value > max_)
+                max_ = value;
+        }
+
+        /**
+         * Adds the counts of other, std::invalid_argument if it does not use the same bits
+         */
+        void merge(const StreamingHistogram& other);
+
+        void clear();
+
+        /**
+         * Recorded values, negative ones not included
+         */
+        std::uint64_t count() const { return total_; }
+
+        std::uint64_t negative() const { return negative_; }
+
+        /**
+         * Exact, 0 while empty
+         */
+        std::int64_t min() const { return total_ == 0 ? 0 : min_; }
+
+        std::int64_t max() const { return total_ == 0 ? 0 : max_; }
+
+        double mean() const { return total_ == 0 ? 0 : sum_ / static_cast<double>(total_); }
+
+        /**
+         * The p-th percentile (0 to 100): the middle of the bucket holding that rank, kept inside [min, max]
+         */
+        std::int64_t percentile(double p) const;
+
+        unsigned bits() const { return bits_; }
+
+        std::size_t buckets() const { return counts_.size(); }
+
+        std::size_t memory() const { return sizeof(*this) + counts_.size() * sizeof(std::uint64_t); }
+
+    private:
+        std::size_t index(std::uint64_t value) const {
+            const unsigned width = static_cast<unsigned>(std::bit_width(value));
+            if (width <= bits_)
+                return static_cast<std::size_t>(value);
+            // the top bits of the value, shifted into [2^(bits-1), 2^bits), after the buckets of smaller exponents
+            const unsigned shift = width - bits_;
+            return (static_cast<std::size_t>(shift) << (bits_ - 1)) + static_cast<std::size_t>(value >> shift);
+        }
+
+        std::uint64_t lowest(std::size_t index) const;
+
+        std::uint64_t highest(std::size_t index) const;
+
+        unsigned bits_;
+        std::vector<std::uint64_t> counts_;
+        std::uint64_t total_{0};
+        std::uint64_t negative_{0};
+        double sum_{0};
+        std::int64_t min_;
+        std::int64_t max_;
+    };
+}
+
+#endif //SECTION_9_CONTROLLING_PROGRAM_FLOW_STREAMING_HISTOGRAM_H
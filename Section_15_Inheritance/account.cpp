@@ -4,8 +4,10 @@
 
 #include <iostream>
 #include "account.h"
+#include "alloc_tracker.h"
 
 Account::Account() {
+    ALLOC_TRACKER_SCOPE("Account");
     std::cout << "(" << this << ")Account constructor ()" << std::endl;
     p_balance = new double;
     *p_balance = 0;
@@ -17,6 +19,7 @@ Account::Account(double amount) : Account() {
 }
 
 Account::Account(const Account& account) : p_balance{nullptr} {
+    ALLOC_TRACKER_SCOPE("Account");
     std::cout << "(" << this << ")Account copy constructor (" << &account << ")" << std::endl;
     p_balance = new double;
     *p_balance = *account.p_balance;
@@ -50,6 +53,7 @@ void Account::set_balance(double amount) {
 }
 
 Account& Account::operator=(const Account& other) {
+    ALLOC_TRACKER_SCOPE("Account");
     std::cout << "(" << this << ")Account copy assignment (" << &other << ")" << std::endl;
     if (this == &other)
         return *this;
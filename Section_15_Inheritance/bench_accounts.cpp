@@ -0,0 +1,49 @@
+#include <memory>
+#include <utility>
+
+#include "benchmark.h"
+#include "account.h"
+#include "savings_account.h"
+
+void bm_account_construct(bench::State& state) {
+    while (state.keep_running()) {
+        Account account{100.0};
+        bench::do_not_optimize(account);
+    }
+}
+BENCHMARK(bm_account_construct);
+
+void bm_account_copy(bench::State& state) {
+    Account source{100.0};
+    while (state.keep_running()) {
+        Account copy{source};
+        bench::do_not_optimize(copy);
+    }
+}
+BENCHMARK(bm_account_copy);
+
+void bm_account_move(bench::State& state) {
+    while (state.keep_running()) {
+        Account source{100.0};
+        Account moved{std::move(source)};
+        bench::do_not_optimize(moved);
+    }
+}
+BENCHMARK(bm_account_move);
+
+void bm_savings_account_construct(bench::State& state) {
+    while (state.keep_running()) {
+        SavingsAccount account{0.05, 100.0};
+        bench::do_not_optimize(account);
+    }
+}
+BENCHMARK(bm_savings_account_construct);
+
+void bm_virtual_deposit(bench::State& state) {
+    std::unique_ptr<Account> account = std::make_unique<SavingsAccount>(0.05, 100.0);
+    while (state.keep_running())
+        account->deposit(10.0);
+}
+BENCHMARK(bm_virtual_deposit);
+
+BENCHMARK_MAIN();
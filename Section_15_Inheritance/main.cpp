@@ -1,10 +1,14 @@
 #include <iostream>
+#include "buffered_writer.h"
 #include "savings_account.h"
 #include "account.h"
 
 using namespace std;
 
 int main() {
+    // the accounts log every call with endl, write it through one big buffer instead
+    BufferedWriter out;
+    StreamRedirect redirect{cout, out};
     cout << "\n======Account===================================" << endl;
     Account ac;
     ac.deposit(2000.0);
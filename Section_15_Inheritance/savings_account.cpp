@@ -4,6 +4,7 @@
 
 #include <iostream>
 #include "savings_account.h"
+#include "alloc_tracker.h"
 
 
 SavingsAccount::SavingsAccount() : SavingsAccount(0.1) {
@@ -11,12 +12,14 @@ SavingsAccount::SavingsAccount() : SavingsAccount(0.1) {
 }
 
 SavingsAccount::SavingsAccount(double rate) : Account{}, p_rate{nullptr} {
+    ALLOC_TRACKER_SCOPE("SavingsAccount");
     std::cout << "(" << this << ")SavingsAccount constructor (double)" << std::endl;
     this->p_rate = new double;
     *this->p_rate = rate;
 }
 
 SavingsAccount::SavingsAccount(double rate, double amount) : Account{amount}, p_rate{nullptr} {
+    ALLOC_TRACKER_SCOPE("SavingsAccount");
     std::cout << "(" << this << ")SavingsAccount constructor (double, double)" << std::endl;
     this->p_rate = new double;
     *this->p_rate = rate;
@@ -45,6 +48,7 @@ void SavingsAccount::withdraw(double amount) {
 }
 
 SavingsAccount& SavingsAccount::operator=(const SavingsAccount& sa) {
+    ALLOC_TRACKER_SCOPE("SavingsAccount");
     std::cout << "(" << this << ")SavingsAccount copy assignment (" << &sa << ")" << std::endl;
     if (this == &sa)
         return *this;
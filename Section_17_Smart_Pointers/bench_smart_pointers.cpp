@@ -0,0 +1,443 @@
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include "benchmark.h"
+#include "hive.h"
+#include "intrusive_ptr.h"
+#include "publisher.h"
+#include "reclaimer.h"
+#include "Test.h"
+#include "slab_pool.h"
+
+/*
+ * Test logs in its constructor and destructor, which would hide the cost of the pointers.
+ * These types have the same layout without the logging.
+ */
+struct Payload {
+    int data;
+
+    explicit Payload(int data) : data{data} {}
+};
+
+struct CountedPayload : RefCounted<CountedPayload> {
+    int data;
+
+    explicit CountedPayload(int data) : data{data} {}
+};
+
+struct LocalCountedPayload : RefCounted<LocalCountedPayload, PlainCount> {
+    int data;
+
+    explicit LocalCountedPayload(int data) : data{data} {}
+};
+
+// ==== create + destroy ======================================================
+
+void bm_create_shared_new(bench::State& state) {
+    while (state.keep_running()) {
+        std::shared_ptr<Payload> ptr{new Payload{11}};
+        bench::do_not_optimize(ptr);
+    }
+}
+BENCHMARK(bm_create_shared_new)->threads(1)->threads(16);
+
+void bm_create_make_shared(bench::State& state) {
+    while (state.keep_running()) {
+        std::shared_ptr<Payload> ptr = std::make_shared<Payload>(11);
+        bench::do_not_optimize(ptr);
+    }
+}
+BENCHMARK(bm_create_make_shared)->threads(1)->threads(16);
+
+void bm_create_intrusive(bench::State& state) {
+    while (state.keep_running()) {
+        IntrusivePtr<CountedPayload> ptr = make_intrusive<CountedPayload>(11);
+        bench::do_not_optimize(ptr);
+    }
+}
+BENCHMARK(bm_create_intrusive)->threads(1)->threads(16);
+
+void bm_create_intrusive_plain(bench::State& state) {
+    while (state.keep_running()) {
+        IntrusivePtr<LocalCountedPayload> ptr = make_intrusive<LocalCountedPayload>(11);
+        bench::do_not_optimize(ptr);
+    }
+}
+BENCHMARK(bm_create_intrusive_plain)->threads(1)->threads(16);
+
+// ==== copy + destroy of one object shared by every thread ===================
+
+void bm_copy_shared_new(bench::State& state) {
+    static const std::shared_ptr<Payload> source{new Payload{11}};
+    while (state.keep_running()) {
+        std::shared_ptr<Payload> copy{source};
+        bench::do_not_optimize(copy);
+    }
+}
+BENCHMARK(bm_copy_shared_new)->threads(1)->threads(16);
+
+void bm_copy_make_shared(bench::State& state) {
+    static const std::shared_ptr<Payload> source = std::make_shared<Payload>(11);
+    while (state.keep_running()) {
+        std::shared_ptr<Payload> copy{source};
+        bench::do_not_optimize(copy);
+    }
+}
+BENCHMARK(bm_copy_make_shared)->threads(1)->threads(16);
+
+void bm_copy_intrusive(bench::State& state) {
+    static const IntrusivePtr<CountedPayload> source = make_intrusive<CountedPayload>(11);
+    while (state.keep_running()) {
+        IntrusivePtr<CountedPayload> copy{source};
+        bench::do_not_optimize(copy);
+    }
+}
+BENCHMARK(bm_copy_intrusive)->threads(1)->threads(16);
+
+// a plain count cannot be shared between threads, every thread copies its own object
+void bm_copy_intrusive_plain(bench::State& state) {
+    const IntrusivePtr<LocalCountedPayload> source = make_intrusive<LocalCountedPayload>(11);
+    while (state.keep_running()) {
+        IntrusivePtr<LocalCountedPayload> copy{source};
+        bench::do_not_optimize(copy);
+    }
+}
+BENCHMARK(bm_copy_intrusive_plain)->threads(1)->threads(16);
+
+// ==== filling a vector of owned objects =====================================
+
+void bm_fill_make_unique(bench::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    while (state.keep_running()) {
+        std::vector<std::unique_ptr<Payload>> payloads;
+        payloads.reserve(count);
+        for (std::size_t i{0}; i < count; i++)
+            payloads.push_back(std::make_unique<Payload>(static_cast<int>(i)));
+        bench::do_not_optimize(payloads.data());
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_fill_make_unique)->arg(1000000);
+
+void bm_fill_pool_unique(bench::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    while (state.keep_running()) {
+        SlabPool pool;
+        std::vector<PoolUniquePtr<Payload>> payloads;
+        payloads.reserve(count);
+        for (std::size_t i{0}; i < count; i++)
+            payloads.push_back(make_pool_unique<Payload>(pool, static_cast<int>(i)));
+        bench::do_not_optimize(payloads.data());
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_fill_pool_unique)->arg(1000000);
+
+void bm_fill_make_shared(bench::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    while (state.keep_running()) {
+        std::vector<std::shared_ptr<Payload>> payloads;
+        payloads.reserve(count);
+        for (std::size_t i{0}; i < count; i++)
+            payloads.push_back(std::make_shared<Payload>(static_cast<int>(i)));
+        bench::do_not_optimize(payloads.data());
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_fill_make_shared)->arg(1000000);
+
+void bm_fill_pool_shared(bench::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    while (state.keep_running()) {
+        SlabPool pool;
+        std::vector<std::shared_ptr<Payload>> payloads;
+        payloads.reserve(count);
+        for (std::size_t i{0}; i < count; i++)
+            payloads.push_back(make_pool_shared<Payload>(pool, static_cast<int>(i)));
+        bench::do_not_optimize(payloads.data());
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_fill_pool_shared)->arg(1000000);
+
+// ==== iterating owned objects ===============================================
+
+/*
+ * The containers are built once (10M elements take a while) and shared by the runs.
+ */
+std::vector<std::unique_ptr<Payload>>& payload_pointers(std::size_t count) {
+    static std::vector<std::unique_ptr<Payload>> payloads;
+    if (payloads.size() != count) {
+        payloads.clear();
+        payloads.reserve(count);
+        for (std::size_t i{0}; i < count; i++)
+            payloads.push_back(std::make_unique<Payload>(static_cast<int>(i)));
+    }
+    return payloads;
+}
+
+/*
+ * Same objects visited in random order, like a vector that went through many inserts and erases
+ */
+std::vector<Payload*>& shuffled_payload_pointers(std::size_t count) {
+    static std::vector<Payload*> pointers;
+    if (pointers.size() != count) {
+        pointers.clear();
+        for (const auto& payload: payload_pointers(count))
+            pointers.push_back(payload.get());
+        std::shuffle(pointers.begin(), pointers.end(), std::mt19937{42});
+    }
+    return pointers;
+}
+
+Hive<Payload>& payload_hive(std::size_t count) {
+    static Hive<Payload> hive;
+    if (hive.size() != count) {
+        hive.clear();
+        hive.reserve(count);
+        for (std::size_t i{0}; i < count; i++)
+            hive.emplace(static_cast<int>(i));
+    }
+    return hive;
+}
+
+void bm_iterate_vector_unique_ptr(bench::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto& payloads = payload_pointers(count);
+    while (state.keep_running()) {
+        long long sum{0};
+        for (const auto& payload: payloads)
+            sum += payload->data;
+        bench::do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_iterate_vector_unique_ptr)->arg(10000000);
+
+void bm_iterate_vector_unique_ptr_shuffled(bench::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto& pointers = shuffled_payload_pointers(count);
+    while (state.keep_running()) {
+        long long sum{0};
+        for (const Payload* payload: pointers)
+            sum += payload->data;
+        bench::do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_iterate_vector_unique_ptr_shuffled)->arg(10000000);
+
+void bm_iterate_hive(bench::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto& hive = payload_hive(count);
+    while (state.keep_running()) {
+        long long sum{0};
+        for (const auto& payload: hive)
+            sum += payload.data;
+        bench::do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_iterate_hive)->arg(10000000);
+
+void bm_iterate_hive_for_each(bench::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    auto& hive = payload_hive(count);
+    while (state.keep_running()) {
+        long long sum{0};
+        hive.for_each([&sum](const Payload& payload) { sum += payload.data; });
+        bench::do_not_optimize(sum);
+    }
+    state.set_items_processed(state.iterations() * count);
+}
+BENCHMARK(bm_iterate_hive_for_each)->arg(10000000);
+
+void bm_erase_hive(bench::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    while (state.keep_running()) {
+        state.pause_timing();
+        Hive<Payload> hive;
+        for (std::size_t i{0}; i < count; i++)
+            hive.emplace(static_cast<int>(i));
+        state.resume_timing();
+
+        // erase every other element, the remaining ones do not move
+        for (auto it = hive.begin(); it != hive.end();) {
+            it = hive.erase(it);
+            if (it != hive.end())
+                ++it;
+        }
+        bench::do_not_optimize(hive.size());
+    }
+    state.set_items_processed(state.iterations() * count / 2);
+}
+BENCHMARK(bm_erase_hive)->arg(1000000);
+
+// ==== read-mostly shared object =============================================
+
+/*
+ * Every thread reads the published object; thread 0 also publishes a new version
+ * every publish_interval reads.
+ */
+constexpr std::size_t publish_interval{4096};
+
+Publisher<Payload>& payload_publisher() {
+    static Publisher<Payload> publisher{std::make_shared<const Payload>(0)};
+    return publisher;
+}
+
+void bm_read_mutex(bench::State& state) {
+    static std::mutex mutex;
+    static std::shared_ptr<const Payload> current = std::make_shared<const Payload>(0);
+    long long sum{0};
+    std::size_t i{0};
+    while (state.keep_running()) {
+        std::shared_ptr<const Payload> snapshot;
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            if (state.thread_index() == 0 && ++i % publish_interval == 0)
+                current = std::make_shared<const Payload>(static_cast<int>(i));
+            snapshot = current;
+        }
+        sum += snapshot->data;
+    }
+    bench::do_not_optimize(sum);
+    state.set_items_processed(state.iterations());
+}
+BENCHMARK(bm_read_mutex)->threads(1)->threads(2)->threads(4)->threads(8)->threads(16)->threads(32);
+
+void bm_read_atomic_shared_ptr(bench::State& state) {
+    auto& publisher = payload_publisher();
+    long long sum{0};
+    std::size_t i{0};
+    while (state.keep_running()) {
+        if (state.thread_index() == 0 && ++i % publish_interval == 0)
+            publisher.publish(std::make_shared<const Payload>(static_cast<int>(i)));
+        sum += publisher.load()->data;
+    }
+    bench::do_not_optimize(sum);
+    state.set_items_processed(state.iterations());
+}
+BENCHMARK(bm_read_atomic_shared_ptr)->threads(1)->threads(2)->threads(4)->threads(8)->threads(16)->threads(32);
+
+void bm_read_cached_reader(bench::State& state) {
+    auto& publisher = payload_publisher();
+    Publisher<Payload>::Reader reader{publisher};
+    long long sum{0};
+    std::size_t i{0};
+    while (state.keep_running()) {
+        if (state.thread_index() == 0 && ++i % publish_interval == 0)
+            publisher.publish(std::make_shared<const Payload>(static_cast<int>(i)));
+        sum += reader->data;
+    }
+    bench::do_not_optimize(sum);
+    state.set_items_processed(state.iterations());
+}
+BENCHMARK(bm_read_cached_reader)->threads(1)->threads(2)->threads(4)->threads(8)->threads(16)->threads(32);
+
+// ==== release latency =======================================================
+
+/*
+ * Each iteration builds a vector of range(0) Test objects (not timed) and measures only how long
+ * the releasing thread takes to leave the scope. The percentiles go to the counters.
+ */
+template<class Release>
+void measure_release(bench::State& state, Release release) {
+    std::vector<double> latencies;
+    latencies.reserve(state.iterations());
+
+    while (state.keep_running())
+        latencies.push_back(std::chrono::duration<double, std::micro>(release()).count());
+    Reclaimer::global().drain();
+
+    std::sort(latencies.begin(), latencies.end());
+    auto percentile = [&latencies](double p) {
+        return latencies[static_cast<std::size_t>(p * static_cast<double>(latencies.size() - 1))];
+    };
+    state.set_counter("p50_us", percentile(0.50));
+    state.set_counter("p99_us", percentile(0.99));
+    state.set_counter("max_us", latencies.back());
+}
+
+void bm_release_vector(bench::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    measure_release(state, [&state, count] {
+        state.pause_timing();
+        std::vector<std::unique_ptr<Test>> tests;
+        tests.reserve(count);
+        for (std::size_t i{0}; i < count; i++)
+            tests.push_back(std::make_unique<Test>(static_cast<int>(i)));
+        state.resume_timing();
+
+        auto start = std::chrono::steady_clock::now();
+        tests.clear();
+        return std::chrono::steady_clock::now() - start;
+    });
+}
+BENCHMARK(bm_release_vector)->arg(10000);
+
+void bm_release_vector_deferred_deleter(bench::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    measure_release(state, [&state, count] {
+        state.pause_timing();
+        std::vector<DeferredUniquePtr<Test>> tests;
+        tests.reserve(count);
+        for (std::size_t i{0}; i < count; i++)
+            tests.push_back(make_deferred_unique<Test>(static_cast<int>(i)));
+        state.resume_timing();
+
+        auto start = std::chrono::steady_clock::now();
+        tests.clear();
+        return std::chrono::steady_clock::now() - start;
+    });
+}
+BENCHMARK(bm_release_vector_deferred_deleter)->arg(10000);
+
+void bm_release_vector_retire_value(bench::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    measure_release(state, [&state, count] {
+        state.pause_timing();
+        std::vector<std::unique_ptr<Test>> tests;
+        tests.reserve(count);
+        for (std::size_t i{0}; i < count; i++)
+            tests.push_back(std::make_unique<Test>(static_cast<int>(i)));
+        state.resume_timing();
+
+        auto start = std::chrono::steady_clock::now();
+        Reclaimer::global().retire_value(std::move(tests));
+        return std::chrono::steady_clock::now() - start;
+    });
+}
+BENCHMARK(bm_release_vector_retire_value)->arg(10000);
+
+void bm_release_last_shared_ptr(bench::State& state) {
+    measure_release(state, [&state] {
+        state.pause_timing();
+        std::shared_ptr<Test> test = std::make_shared<Test>(1);
+        state.resume_timing();
+
+        auto start = std::chrono::steady_clock::now();
+        test.reset();
+        return std::chrono::steady_clock::now() - start;
+    });
+}
+BENCHMARK(bm_release_last_shared_ptr);
+
+void bm_release_last_shared_ptr_deferred(bench::State& state) {
+    measure_release(state, [&state] {
+        state.pause_timing();
+        std::shared_ptr<Test> test = make_deferred_shared<Test>(1);
+        state.resume_timing();
+
+        auto start = std::chrono::steady_clock::now();
+        test.reset();
+        return std::chrono::steady_clock::now() - start;
+    });
+}
+BENCHMARK(bm_release_last_shared_ptr_deferred);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,27 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_17_SMART_POINTERS_COUNTED_TEST_H
+#define SECTION_17_SMART_POINTERS_COUNTED_TEST_H
+
+#include "intrusive_ptr.h"
+#include "Test.h"
+
+/**
+ * Test with an intrusive reference count, to be owned by IntrusivePtr
+ */
+class CountedTest : public Test, public RefCounted<CountedTest> {
+public:
+    using Test::Test;
+};
+
+/**
+ * Same, with a non-atomic count. Only for objects that stay in one thread.
+ */
+class LocalCountedTest : public Test, public RefCounted<LocalCountedTest, PlainCount> {
+public:
+    using Test::Test;
+};
+
+#endif //SECTION_17_SMART_POINTERS_COUNTED_TEST_H
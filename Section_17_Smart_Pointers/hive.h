@@ -0,0 +1,306 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_17_SMART_POINTERS_HIVE_H
+#define SECTION_17_SMART_POINTERS_HIVE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Owning container with stable addresses (in the spirit of plf::colony / std::hive).
+ *
+ * std::vector<std::unique_ptr<T>> gives every element its own heap allocation, so iterating
+ * follows one pointer per element to a different place in memory.
+ * Hive stores the elements themselves in blocks of block_capacity slots:
+ * - inserting never moves existing elements, so pointers and iterators stay valid
+ * - erasing is O(1): the slot is marked free in the block's bitmap and reused by the next insert
+ * - iterating walks the blocks in order and skips the free slots 64 at a time
+ *
+ * Element order is not preserved across erase/insert.
+ */
+template<class T>
+class Hive {
+public:
+    static constexpr std::size_t block_capacity{1024};
+
+private:
+    static constexpr std::size_t word_bits{64};
+    static constexpr std::size_t words{block_capacity / word_bits};
+
+    struct Block {
+        std::uint64_t occupied[words]{};  // bit i set when slot i holds an element
+        std::size_t count{0};             // live elements
+        std::size_t used{0};              // slots handed out at least once
+        std::size_t index{0};             // position in blocks
+        Block* next{nullptr};             // the block after this one, iterators follow these links
+        alignas(T) unsigned char storage[block_capacity * sizeof(T)];
+
+        T* slot(std::size_t i) { return std::launder(reinterpret_cast<T*>(storage) + i); }
+
+        bool is_occupied(std::size_t i) const { return (occupied[i / word_bits] >> (i % word_bits)) & 1U; }
+
+        /**
+         * First occupied slot at or after i, block_capacity if there is none
+         */
+        std::size_t next_occupied(std::size_t i) const {
+            while (i < used) {
+                std::uint64_t word = occupied[i / word_bits] >> (i % word_bits);
+                if (word != 0)
+                    return i + count_trailing_zeros(word);
+                i = (i / word_bits + 1) * word_bits;
+            }
+            return block_capacity;
+        }
+    };
+
+    struct FreeSlot {
+        std::uint32_t block;
+        std::uint32_t slot;
+    };
+
+    std::vector<std::unique_ptr<Block>> blocks;
+    std::vector<FreeSlot> free_slots;
+    std::size_t element_count{0};
+
+    static std::size_t count_trailing_zeros(std::uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+        std::size_t n{0};
+        while ((word & 1U) == 0) {
+            word >>= 1;
+            ++n;
+        }
+        return n;
+#endif
+    }
+
+    template<bool Const>
+    class Iterator {
+    private:
+        // the block itself, not a position in blocks: growing blocks does not move the Block objects
+        Block* block;
+        std::size_t slot;
+
+        friend class Hive;
+
+        Iterator(Block* block, std::size_t slot) : block{block}, slot{slot} {
+            skip_free();
+        }
+
+        void skip_free() {
+            while (block != nullptr) {
+                slot = block->next_occupied(slot);
+                if (slot != block_capacity)
+                    return;
+                block = block->next;
+                slot = 0;
+            }
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T*, T*>;
+        using reference = std::conditional_t<Const, const T&, T&>;
+
+        Iterator() : block{nullptr}, slot{0} {}
+
+        // iterator converts to const_iterator
+        template<bool C = Const, class = std::enable_if_t<C>>
+        Iterator(const Iterator<false>& other) : block{other.block}, slot{other.slot} {}
+
+        reference operator*() const { return *block->slot(slot); }
+
+        pointer operator->() const { return block->slot(slot); }
+
+        Iterator& operator++() {
+            ++slot;
+            const Block& current = *block;
+            if (slot < current.used && current.is_occupied(slot))
+                return *this;   // common case: the next slot is in use
+            skip_free();
+            return *this;
+        }
+
+        Iterator operator++(int) {
+            Iterator previous{*this};
+            ++*this;
+            return previous;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) {
+            return lhs.block == rhs.block && lhs.slot == rhs.slot;
+        }
+
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs) { return !(lhs == rhs); }
+
+        template<bool>
+        friend class Iterator;
+    };
+
+public:
+    using value_type = T;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    Hive() = default;
+
+    Hive(const Hive&) = delete;
+
+    Hive& operator=(const Hive&) = delete;
+
+    Hive(Hive&& other) noexcept
+            : blocks{std::move(other.blocks)}, free_slots{std::move(other.free_slots)},
+              element_count{other.element_count} {
+        other.element_count = 0;
+    }
+
+    Hive& operator=(Hive&& other) noexcept {
+        clear();
+        blocks = std::move(other.blocks);
+        free_slots = std::move(other.free_slots);
+        element_count = other.element_count;
+        other.element_count = 0;
+        return *this;
+    }
+
+    ~Hive() { clear(); }
+
+    /**
+     * Constructs an element in a free slot (or a new one) and returns an iterator to it
+     */
+    template<class... Args>
+    iterator emplace(Args&& ... args) {
+        std::size_t block_index;
+        std::size_t slot;
+        if (!free_slots.empty()) {
+            block_index = free_slots.back().block;
+            slot = free_slots.back().slot;
+        } else {
+            if (blocks.empty() || blocks.back()->used == block_capacity) {
+                std::unique_ptr<Block> added{new Block};  // storage left uninitialized
+                added->index = blocks.size();
+                blocks.push_back(std::move(added));
+                if (blocks.size() > 1)
+                    blocks[blocks.size() - 2]->next = blocks.back().get();
+            }
+            block_index = blocks.size() - 1;
+            slot = blocks.back()->used;
+        }
+
+        Block& block = *blocks[block_index];
+        ::new(static_cast<void*>(block.slot(slot))) T(std::forward<Args>(args)...);
+
+        // only commit the bookkeeping once the constructor did not throw
+        if (!free_slots.empty())
+            free_slots.pop_back();
+        else
+            ++block.used;
+        block.occupied[slot / word_bits] |= std::uint64_t{1} << (slot % word_bits);
+        ++block.count;
+        ++element_count;
+
+        return iterator{blocks[block_index].get(), slot};
+    }
+
+    iterator insert(const T& value) { return emplace(value); }
+
+    iterator insert(T&& value) { return emplace(std::move(value)); }
+
+    /**
+     * Destroys the element in O(1), the other elements keep their address.
+     * Returns the iterator following the erased element.
+     */
+    iterator erase(const_iterator position) {
+        Block& block = *position.block;
+        const std::size_t slot = position.slot;
+
+        block.slot(slot)->~T();
+        block.occupied[slot / word_bits] &= ~(std::uint64_t{1} << (slot % word_bits));
+        --block.count;
+        --element_count;
+        free_slots.push_back({static_cast<std::uint32_t>(block.index), static_cast<std::uint32_t>(slot)});
+
+        return iterator{position.block, slot + 1};
+    }
+
+    /**
+     * Iterator to the element at address p, O(number of blocks)
+     */
+    iterator get_iterator(const T* p) {
+        for (auto& block: blocks) {
+            const T* first = block->slot(0);
+            if (p >= first && p < first + block_capacity)
+                return iterator{block.get(), static_cast<std::size_t>(p - first)};
+        }
+        return end();
+    }
+
+    void clear() {
+        for (auto& block: blocks) {
+            for (std::size_t i = block->next_occupied(0); i != block_capacity; i = block->next_occupied(i + 1))
+                block->slot(i)->~T();
+        }
+        blocks.clear();
+        free_slots.clear();
+        element_count = 0;
+    }
+
+    /**
+     * Reserves room in the block table for n elements; blocks themselves are allocated on demand
+     */
+    void reserve(std::size_t n) { blocks.reserve((n + block_capacity - 1) / block_capacity); }
+
+    std::size_t size() const { return element_count; }
+
+    bool empty() const { return element_count == 0; }
+
+    iterator begin() { return iterator{blocks.empty() ? nullptr : blocks.front().get(), 0}; }
+
+    /**
+     * Past the last block: stays equal to end() when blocks are added
+     */
+    iterator end() { return iterator{nullptr, 0}; }
+
+    const_iterator begin() const { return const_iterator{blocks.empty() ? nullptr : blocks.front().get(), 0}; }
+
+    const_iterator end() const { return const_iterator{nullptr, 0}; }
+
+    const_iterator cbegin() const { return begin(); }
+
+    const_iterator cend() const { return end(); }
+
+    /**
+     * Calls f on every element, scanning each block's bitmap a word at a time
+     */
+    template<class Function>
+    void for_each(Function f) {
+        for (auto& block: blocks) {
+            if (block->count == block->used) {
+                // no holes: a plain loop the compiler can unroll
+                for (std::size_t i{0}; i < block->used; i++)
+                    f(*block->slot(i));
+                continue;
+            }
+            for (std::size_t w{0}; w < words; w++) {
+                std::uint64_t word = block->occupied[w];
+                while (word != 0) {
+                    f(*block->slot(w * word_bits + count_trailing_zeros(word)));
+                    word &= word - 1;
+                }
+            }
+        }
+    }
+};
+
+#endif //SECTION_17_SMART_POINTERS_HIVE_H
@@ -0,0 +1,142 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_17_SMART_POINTERS_INTRUSIVE_PTR_H
+#define SECTION_17_SMART_POINTERS_INTRUSIVE_PTR_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+/**
+ * Reference counter stored inside the object.
+ * std::shared_ptr keeps the count in a separate control block (a second allocation
+ * unless make_shared is used) and always updates it atomically.
+ * With an intrusive count the object and its count live in one allocation,
+ * and single threaded code can use a plain integer.
+ */
+struct AtomicCount {
+    std::atomic<long> value{0};
+
+    void increment() { value.fetch_add(1, std::memory_order_relaxed); }
+
+    // acq_rel so the thread that deletes sees every write done through the other owners
+    bool decrement() { return value.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+
+    long get() const { return value.load(std::memory_order_relaxed); }
+};
+
+struct PlainCount {
+    long value{0};
+
+    void increment() { ++value; }
+
+    bool decrement() { return --value == 0; }
+
+    long get() const { return value; }
+};
+
+/**
+ * Base class for the types owned by IntrusivePtr (CRTP).
+ * class Node : public RefCounted<Node> { ... };
+ * Use RefCounted<Node, PlainCount> when the objects are never shared between threads.
+ */
+template<class Derived, class Count = AtomicCount>
+class RefCounted {
+private:
+    mutable Count count;
+
+    friend void intrusive_add_ref(const RefCounted* p) {
+        p->count.increment();
+    }
+
+    friend void intrusive_release(const RefCounted* p) {
+        if (p->count.decrement())
+            delete static_cast<const Derived*>(p);
+    }
+
+protected:
+    RefCounted() = default;
+
+    // copying an object must not copy its owners
+    RefCounted(const RefCounted&) : count{} {}
+
+    RefCounted& operator=(const RefCounted&) { return *this; }
+
+    ~RefCounted() = default;
+
+public:
+    long use_count() const { return count.get(); }
+};
+
+template<class T>
+class IntrusivePtr {
+private:
+    T* ptr;
+
+public:
+    IntrusivePtr() noexcept: ptr{nullptr} {}
+
+    IntrusivePtr(std::nullptr_t) noexcept: ptr{nullptr} {}
+
+    /**
+     * Takes (shared) ownership of p
+     */
+    explicit IntrusivePtr(T* p) : ptr{p} {
+        if (ptr != nullptr)
+            intrusive_add_ref(ptr);
+    }
+
+    IntrusivePtr(const IntrusivePtr& other) : ptr{other.ptr} {
+        if (ptr != nullptr)
+            intrusive_add_ref(ptr);
+    }
+
+    IntrusivePtr(IntrusivePtr&& other) noexcept: ptr{other.ptr} {
+        other.ptr = nullptr;
+    }
+
+    ~IntrusivePtr() {
+        if (ptr != nullptr)
+            intrusive_release(ptr);
+    }
+
+    IntrusivePtr& operator=(const IntrusivePtr& other) {
+        IntrusivePtr{other}.swap(*this);
+        return *this;
+    }
+
+    IntrusivePtr& operator=(IntrusivePtr&& other) noexcept {
+        IntrusivePtr{std::move(other)}.swap(*this);
+        return *this;
+    }
+
+    void reset() { IntrusivePtr{}.swap(*this); }
+
+    void swap(IntrusivePtr& other) noexcept { std::swap(ptr, other.ptr); }
+
+    T* get() const { return ptr; }
+
+    T& operator*() const { return *ptr; }
+
+    T* operator->() const { return ptr; }
+
+    explicit operator bool() const { return ptr != nullptr; }
+
+    long use_count() const { return ptr == nullptr ? 0 : ptr->use_count(); }
+
+    friend bool operator==(const IntrusivePtr& lhs, const IntrusivePtr& rhs) { return lhs.ptr == rhs.ptr; }
+
+    friend bool operator!=(const IntrusivePtr& lhs, const IntrusivePtr& rhs) { return lhs.ptr != rhs.ptr; }
+};
+
+/**
+ * Like std::make_shared, a single allocation holds the object and its count
+ */
+template<class T, class... Args>
+IntrusivePtr<T> make_intrusive(Args&& ... args) {
+    return IntrusivePtr<T>{new T(std::forward<Args>(args)...)};
+}
+
+#endif //SECTION_17_SMART_POINTERS_INTRUSIVE_PTR_H
@@ -3,11 +3,19 @@
 #include <vector>
 
 #include "Test.h"
+#include "counted_test.h"
+#include "hive.h"
+#include "publisher.h"
+#include "reclaimer.h"
+#include "weak_cache.h"
+#include "slab_pool.h"
 
 void weak_function(const std::weak_ptr<Test> ptr);
 
 void shared_function(const std::shared_ptr<Test> ptr);
 
+void intrusive_function(const IntrusivePtr<CountedTest>& ptr);
+
 int main() {
     std::cout << "=== unique_ptr ===========================================" << std::endl;
 
@@ -42,6 +50,57 @@ int main() {
         }
     }
 
+    std::cout << "=== deferred destruction =================================" << std::endl;
+    {
+        Reclaimer reclaimer;
+        {
+            std::vector<std::unique_ptr<Test>> tests;
+            tests.push_back(std::make_unique<Test>(1000));
+            tests.push_back(std::make_unique<Test>(2000));
+
+            // the destructors run on the reclaimer's thread, leaving the scope only moves the vector
+            reclaimer.retire_value(std::move(tests));
+
+            DeferredUniquePtr<Test> ptr_dt1{new Test{3000}, DeferredDeleter<Test>{reclaimer}};
+        }
+        std::cout << "Scope left" << std::endl;
+        reclaimer.drain();
+        std::cout << "Reclaimer drained" << std::endl;
+    }
+
+    std::cout << "=== hive ================================================" << std::endl;
+    {
+        // the Test objects live next to each other in blocks instead of one allocation each
+        Hive<Test> tests;
+        tests.emplace(100);
+        auto second = tests.emplace(200);
+        const Test* third = &*tests.emplace(300);
+
+        tests.erase(second); // O(1), the other elements keep their address
+        tests.emplace(400);  // reuses the freed slot
+
+        for (const auto& test: tests)
+            std::cout << "Test[" << &test << "]: data=" << test.get_data() << std::endl;
+        std::cout << "third is still at " << third << ", data=" << third->get_data() << std::endl;
+    }
+
+    std::cout << "=== pool allocation ======================================" << std::endl;
+    {
+        // the pool must be declared before (and so destroyed after) the pointers using it
+        SlabPool pool;
+
+        std::vector<PoolUniquePtr<Test>> tests;
+        tests.push_back(make_pool_unique<Test>(pool, 500));
+        tests.push_back(make_pool_unique<Test>(pool, 600));
+
+        for (const auto& test: tests)
+            std::cout << "Test[" << test.get() << "]: data=" << test->get_data() << std::endl;
+
+        std::shared_ptr<Test> ptr_pt1 = make_pool_shared<Test>(pool, 700);
+        std::cout << "ptr_pt1.use_count(): " << ptr_pt1.use_count() << std::endl;
+        std::cout << "slabs used: " << pool.slab_count() << std::endl;
+    }
+
     std::cout << "=== shared_ptr ===========================================" << std::endl;
     {
         std::shared_ptr<int> ptr_si1{new int{100}};
@@ -108,6 +167,53 @@ int main() {
 
     }
 
+    std::cout << "=== publisher (RCU) ======================================" << std::endl;
+    {
+        Publisher<Test> config{std::make_shared<const Test>(1)};
+        Publisher<Test>::Reader reader{config};
+        std::cout << "reader sees: " << reader->get_data() << std::endl;
+
+        // readers keep the old version alive until they look again
+        std::shared_ptr<const Test> old_version = config.load();
+        config.publish(std::make_shared<const Test>(2));
+        std::cout << "old version: " << old_version->get_data() << std::endl;
+        std::cout << "reader sees: " << reader->get_data() << std::endl;
+
+        config.update([](Test& test) { test.set_data(test.get_data() + 1); });
+        const Test& latest = reader.get(); // the reader lets go of version 2, which is deleted
+        std::cout << "reader sees: " << latest.get_data() << std::endl;
+    }
+
+    std::cout << "=== weak cache ===========================================" << std::endl;
+    {
+        WeakCache<int, Test> cache;
+        std::shared_ptr<Test> ptr_c1 = cache.get(7, [] { return new Test{7}; });
+        std::shared_ptr<Test> ptr_c2 = cache.get(7, [] { return new Test{7}; }); // same object
+        std::cout << "same object: " << (ptr_c1 == ptr_c2) << ", cache size: " << cache.size() << std::endl;
+
+        ptr_c1.reset();
+        ptr_c2.reset(); // last owner gone: the object and its cache entry are removed
+        std::cout << "cache size: " << cache.size() << std::endl;
+    }
+
+    std::cout << "=== intrusive_ptr ========================================" << std::endl;
+    {
+        // the count lives inside the object: one allocation, and no control block
+        IntrusivePtr<CountedTest> ptr_it1 = make_intrusive<CountedTest>(55);
+        std::cout << "ptr_it1.get(): " << ptr_it1.get() << std::endl;
+        std::cout << "ptr_it1.use_count(): " << ptr_it1.use_count() << std::endl;
+
+        IntrusivePtr<CountedTest> ptr_it2{ptr_it1};
+        std::cout << "ptr_it2.use_count(): " << ptr_it2.use_count() << std::endl;
+
+        // passing by const reference does not touch the count
+        intrusive_function(ptr_it1);
+
+        // objects that never leave this thread can use a plain (non-atomic) count
+        IntrusivePtr<LocalCountedTest> ptr_it3 = make_intrusive<LocalCountedTest>(66);
+        std::cout << "ptr_it3.use_count(): " << ptr_it3.use_count() << std::endl;
+    }
+
     return 0;
 }
 
@@ -130,3 +236,13 @@ void weak_function(const std::weak_ptr<Test> ptr) {
 
     cout << "Leaving weak_function" << endl;
 }
+
+void intrusive_function(const IntrusivePtr<CountedTest>& ptr) {
+    using namespace std;
+
+    cout << "Inside intrusive_function" << endl;
+    cout << "ptr.get(): " << ptr.get() << endl;
+    cout << "ptr.use_count(): " << ptr.use_count() << endl;
+
+    cout << "Leaving intrusive_function" << endl;
+}
@@ -0,0 +1,119 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_17_SMART_POINTERS_PUBLISHER_H
+#define SECTION_17_SMART_POINTERS_PUBLISHER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+/**
+ * RCU-style publication of a shared, read-mostly object (a configuration for example).
+ *
+ * The writer builds a new immutable version and publishes it; readers keep using the version
+ * they hold until they look again. An old version is deleted when its last reader lets it go,
+ * which is the "grace period" of RCU done with reference counting.
+ *
+ * Publisher::load() copies the shared_ptr, so every read updates the shared count.
+ * With many reader threads that cache line bounces between cores; Publisher::Reader avoids it
+ * by keeping its own copy and only reloading when the version number changed.
+ */
+template<class T>
+class Publisher {
+private:
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<std::shared_ptr<const T>> current;
+#else
+    std::shared_ptr<const T> current; // accessed with std::atomic_load / std::atomic_store
+#endif
+    std::atomic<std::uint64_t> version{0};
+
+public:
+    explicit Publisher(std::shared_ptr<const T> initial) : current{std::move(initial)} {}
+
+    Publisher(const Publisher&) = delete;
+
+    Publisher& operator=(const Publisher&) = delete;
+
+    std::shared_ptr<const T> load() const {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        return current.load(std::memory_order_acquire);
+#else
+        return std::atomic_load_explicit(&current, std::memory_order_acquire);
+#endif
+    }
+
+    void publish(std::shared_ptr<const T> next) {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        current.store(std::move(next), std::memory_order_release);
+#else
+        std::atomic_store_explicit(&current, std::move(next), std::memory_order_release);
+#endif
+        version.fetch_add(1, std::memory_order_release);
+    }
+
+    /**
+     * Copy - modify - publish. Retries when another writer published in between.
+     */
+    template<class Function>
+    void update(Function modify) {
+        std::shared_ptr<const T> expected = load();
+        for (;;) {
+            auto next = std::make_shared<T>(*expected);
+            modify(*next);
+            std::shared_ptr<const T> desired{std::move(next)};
+#if defined(__cpp_lib_atomic_shared_ptr)
+            if (current.compare_exchange_weak(expected, desired, std::memory_order_acq_rel))
+                break;
+#else
+            if (std::atomic_compare_exchange_weak_explicit(&current, &expected, desired,
+                                                           std::memory_order_acq_rel, std::memory_order_acquire))
+                break;
+#endif
+        }
+        version.fetch_add(1, std::memory_order_release);
+    }
+
+    std::uint64_t get_version() const { return version.load(std::memory_order_acquire); }
+
+    /**
+     * Per-thread read handle. get() costs one load of the version counter while nothing changes.
+     * A Reader must not be shared between threads.
+     */
+    class Reader {
+    private:
+        const Publisher* publisher;
+        std::shared_ptr<const T> snapshot;
+        std::uint64_t seen_version;
+
+    public:
+        explicit Reader(const Publisher& publisher)
+                : publisher{&publisher}, seen_version{publisher.get_version()} {
+            snapshot = publisher.load();
+        }
+
+        const T& get() {
+            std::uint64_t v = publisher->get_version();
+            if (v != seen_version) {
+                seen_version = v;
+                snapshot = publisher->load();
+            }
+            return *snapshot;
+        }
+
+        const T* operator->() { return &get(); }
+
+        /**
+         * Drops the held version, so it can be reclaimed while this reader is idle
+         */
+        void release() {
+            snapshot.reset();
+            seen_version = ~std::uint64_t{0};
+        }
+    };
+};
+
+#endif //SECTION_17_SMART_POINTERS_PUBLISHER_H
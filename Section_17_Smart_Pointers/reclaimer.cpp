@@ -0,0 +1,74 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "reclaimer.h"
+
+#include <new>
+
+Reclaimer::Reclaimer() : worker{&Reclaimer::run, this} {
+}
+
+Reclaimer::~Reclaimer() {
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        stopping = true;
+    }
+    has_work.notify_one();
+    worker.join();
+}
+
+void Reclaimer::enqueue(void* ptr, void (* destroy)(void*)) noexcept {
+    bool was_empty;
+    try {
+        std::lock_guard<std::mutex> lock{mutex};
+        was_empty = queue.empty();
+        queue.push_back({ptr, destroy});
+        ++enqueued;
+    } catch (const std::bad_alloc&) {
+        // freeing the object now is better than std::terminate from the caller's destructor
+        destroy(ptr);
+        return;
+    }
+    // the worker is only asleep when the queue was empty
+    if (was_empty)
+        has_work.notify_one();
+}
+
+void Reclaimer::run() {
+    std::vector<Item> batch;
+    std::unique_lock<std::mutex> lock{mutex};
+    for (;;) {
+        has_work.wait(lock, [this] { return stopping || !queue.empty(); });
+        if (queue.empty())
+            return;     // stopping, and nothing left to destroy
+
+        batch.swap(queue);
+        lock.unlock();
+
+        for (const Item& item: batch)
+            item.destroy(item.ptr);
+        std::size_t count = batch.size();
+        batch.clear();
+
+        lock.lock();
+        reclaimed += count;
+        done.notify_all();
+    }
+}
+
+void Reclaimer::drain() {
+    std::unique_lock<std::mutex> lock{mutex};
+    std::size_t target = enqueued;
+    done.wait(lock, [this, target] { return reclaimed >= target; });
+}
+
+std::size_t Reclaimer::pending() {
+    std::lock_guard<std::mutex> lock{mutex};
+    return enqueued - reclaimed;
+}
+
+Reclaimer& Reclaimer::global() {
+    static Reclaimer reclaimer;
+    return reclaimer;
+}
@@ -0,0 +1,120 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_17_SMART_POINTERS_RECLAIMER_H
+#define SECTION_17_SMART_POINTERS_RECLAIMER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Deferred destruction.
+ * Objects handed to a Reclaimer are destroyed later by its background thread, so the thread
+ * that lets them go (a scope exit, the last shared_ptr) only pays for putting a pointer in a queue.
+ * Items are destroyed in batches: the worker takes the whole queue at once.
+ *
+ * Destructors then run on another thread: they must not depend on thread-local state,
+ * and the order in which objects are destroyed is only guaranteed per producer thread.
+ */
+class Reclaimer {
+private:
+    struct Item {
+        void* ptr;
+        void (* destroy)(void*);
+    };
+
+    std::mutex mutex;
+    std::condition_variable has_work;
+    std::condition_variable done;
+    std::vector<Item> queue;
+    std::size_t enqueued{0};
+    std::size_t reclaimed{0};
+    bool stopping{false};
+    std::thread worker;
+
+    /**
+     * Destroys ptr right here when the queue cannot grow: deleters run in noexcept destructors
+     */
+    void enqueue(void* ptr, void (* destroy)(void*)) noexcept;
+
+    void run();
+
+public:
+    Reclaimer();
+
+    Reclaimer(const Reclaimer&) = delete;
+
+    Reclaimer& operator=(const Reclaimer&) = delete;
+
+    /**
+     * Destroys everything still queued, then stops the worker
+     */
+    ~Reclaimer();
+
+    /**
+     * Deletes p on the background thread, or on this one if the queue is out of memory
+     */
+    template<class T>
+    void retire(T* p) noexcept {
+        if (p != nullptr)
+            enqueue(p, [](void* q) { delete static_cast<T*>(q); });
+    }
+
+    /**
+     * Moves a whole object (a vector of unique_ptr for example) to the background thread,
+     * so releasing any number of elements costs one queue push.
+     */
+    template<class T>
+    void retire_value(T&& value) {
+        retire(new std::decay_t<T>(std::forward<T>(value)));
+    }
+
+    /**
+     * Waits until everything retired so far has been destroyed
+     */
+    void drain();
+
+    std::size_t pending();
+
+    /**
+     * Process-wide instance used by DeferredDeleter
+     */
+    static Reclaimer& global();
+};
+
+/**
+ * Deleter for unique_ptr / shared_ptr that hands the object to a Reclaimer
+ */
+template<class T>
+class DeferredDeleter {
+private:
+    Reclaimer* reclaimer;
+public:
+    DeferredDeleter() noexcept: reclaimer{&Reclaimer::global()} {}
+
+    explicit DeferredDeleter(Reclaimer& reclaimer) noexcept: reclaimer{&reclaimer} {}
+
+    void operator()(T* p) const noexcept { reclaimer->retire(p); }
+};
+
+template<class T>
+using DeferredUniquePtr = std::unique_ptr<T, DeferredDeleter<T>>;
+
+template<class T, class... Args>
+DeferredUniquePtr<T> make_deferred_unique(Args&& ... args) {
+    return DeferredUniquePtr<T>{new T(std::forward<Args>(args)...)};
+}
+
+template<class T, class... Args>
+std::shared_ptr<T> make_deferred_shared(Args&& ... args) {
+    return std::shared_ptr<T>{new T(std::forward<Args>(args)...), DeferredDeleter<T>{}};
+}
+
+#endif //SECTION_17_SMART_POINTERS_RECLAIMER_H
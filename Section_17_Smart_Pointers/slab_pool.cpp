@@ -0,0 +1,70 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "slab_pool.h"
+
+#include <algorithm>
+
+SlabPool::SlabPool(std::size_t blocks_per_slab) : blocks_per_slab{blocks_per_slab == 0 ? 1 : blocks_per_slab} {
+}
+
+SlabPool::~SlabPool() {
+    release();
+}
+
+void* SlabPool::allocate(std::size_t size) {
+    if (size == 0)
+        size = 1;
+    if (size > max_block_size)
+        return ::operator new(size);
+
+    SizeClass& size_class = classes[class_of(size)];
+    if (size_class.free_list != nullptr) {
+        FreeBlock* block = size_class.free_list;
+        size_class.free_list = block->next;
+        return block;
+    }
+    if (size_class.next != size_class.end) {
+        void* block = size_class.next;
+        size_class.next += (class_of(size) + 1) * granularity;
+        return block;
+    }
+    return refill(size_class, (class_of(size) + 1) * granularity);
+}
+
+void* SlabPool::refill(SizeClass& size_class, std::size_t block_size) {
+    // room for the slab before it is allocated, so push_back can not throw and leak it; doubling keeps it amortised O(1)
+    if (slabs.size() == slabs.capacity())
+        slabs.reserve(std::max<std::size_t>(8, slabs.capacity() * 2));
+    auto* slab = static_cast<unsigned char*>(::operator new(block_size * blocks_per_slab));
+    slabs.push_back(slab);
+
+    size_class.next = slab + block_size;
+    size_class.end = slab + block_size * blocks_per_slab;
+    return slab;
+}
+
+void SlabPool::deallocate(void* p, std::size_t size) noexcept {
+    if (p == nullptr)
+        return;
+    if (size == 0)
+        size = 1;
+    if (size > max_block_size) {
+        ::operator delete(p);
+        return;
+    }
+
+    SizeClass& size_class = classes[class_of(size)];
+    auto* block = static_cast<FreeBlock*>(p);
+    block->next = size_class.free_list;
+    size_class.free_list = block;
+}
+
+void SlabPool::release() noexcept {
+    for (void* slab: slabs)
+        ::operator delete(slab);
+    slabs.clear();
+    for (auto& size_class: classes)
+        size_class = SizeClass{};
+}
@@ -0,0 +1,144 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_17_SMART_POINTERS_SLAB_POOL_H
+#define SECTION_17_SMART_POINTERS_SLAB_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * Small-object pool.
+ * Memory is taken from the heap in slabs that hold many blocks of the same size,
+ * so filling a container with a million objects costs a few hundred allocations instead of a million.
+ * Freed blocks go to a free list and are reused; the slabs are only returned to the heap
+ * (one delete per slab) when the pool is destroyed or released.
+ *
+ * The pool is not thread safe, and it must outlive every object allocated from it.
+ */
+class SlabPool {
+private:
+    static constexpr std::size_t granularity{alignof(std::max_align_t)};
+    static constexpr std::size_t max_block_size{256};
+    static constexpr std::size_t size_classes{max_block_size / granularity};
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct SizeClass {
+        FreeBlock* free_list{nullptr};
+        unsigned char* next{nullptr};   // bump pointer inside the current slab
+        unsigned char* end{nullptr};
+    };
+
+    std::size_t blocks_per_slab;
+    SizeClass classes[size_classes];
+    std::vector<void*> slabs;
+
+    static std::size_t class_of(std::size_t size) { return (size + granularity - 1) / granularity - 1; }
+
+    void* refill(SizeClass& size_class, std::size_t block_size);
+
+public:
+    explicit SlabPool(std::size_t blocks_per_slab = 4096);
+
+    SlabPool(const SlabPool&) = delete;
+
+    SlabPool& operator=(const SlabPool&) = delete;
+
+    ~SlabPool();
+
+    void* allocate(std::size_t size);
+
+    void deallocate(void* p, std::size_t size) noexcept;
+
+    /**
+     * Returns every slab to the heap at once.
+     * Every object allocated from the pool must be destroyed already.
+     */
+    void release() noexcept;
+
+    std::size_t slab_count() const { return slabs.size(); }
+};
+
+/**
+ * Standard allocator backed by a SlabPool, for std::allocate_shared and the containers
+ */
+template<class T>
+class PoolAllocator {
+    static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+
+private:
+    SlabPool* pool;
+
+    template<class U>
+    friend class PoolAllocator;
+
+public:
+    using value_type = T;
+
+    explicit PoolAllocator(SlabPool& pool) noexcept: pool{&pool} {}
+
+    template<class U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept : pool{other.pool} {}
+
+    T* allocate(std::size_t n) { return static_cast<T*>(pool->allocate(n * sizeof(T))); }
+
+    void deallocate(T* p, std::size_t n) noexcept { pool->deallocate(p, n * sizeof(T)); }
+
+    template<class U>
+    bool operator==(const PoolAllocator<U>& other) const { return pool == other.pool; }
+
+    template<class U>
+    bool operator!=(const PoolAllocator<U>& other) const { return pool != other.pool; }
+};
+
+/**
+ * Deleter that destroys the object and gives its block back to the pool
+ */
+template<class T>
+class PoolDeleter {
+private:
+    SlabPool* pool;
+public:
+    PoolDeleter() noexcept: pool{nullptr} {}
+
+    explicit PoolDeleter(SlabPool& pool) noexcept: pool{&pool} {}
+
+    void operator()(T* p) const noexcept {
+        p->~T();
+        pool->deallocate(p, sizeof(T));
+    }
+};
+
+template<class T>
+using PoolUniquePtr = std::unique_ptr<T, PoolDeleter<T>>;
+
+/**
+ * make_unique that takes the memory from the pool
+ */
+template<class T, class... Args>
+PoolUniquePtr<T> make_pool_unique(SlabPool& pool, Args&& ... args) {
+    void* block = pool.allocate(sizeof(T));
+    try {
+        return PoolUniquePtr<T>{new(block) T(std::forward<Args>(args)...), PoolDeleter<T>{pool}};
+    } catch (...) {
+        pool.deallocate(block, sizeof(T));
+        throw;
+    }
+}
+
+/**
+ * make_shared that takes the memory (object and control block) from the pool
+ */
+template<class T, class... Args>
+std::shared_ptr<T> make_pool_shared(SlabPool& pool, Args&& ... args) {
+    return std::allocate_shared<T>(PoolAllocator<T>{pool}, std::forward<Args>(args)...);
+}
+
+#endif //SECTION_17_SMART_POINTERS_SLAB_POOL_H
@@ -0,0 +1,67 @@
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+#include "hive.h"
+
+/**
+ * Iterators taken before the block table grows must keep working (CTest: Section_17_Hive_Test)
+ */
+namespace {
+    int failures{0};
+
+    void check(bool condition, const char* what) {
+        if (!condition) {
+            std::cerr << "FAILED: " << what << std::endl;
+            ++failures;
+        }
+    }
+}
+
+int main() {
+    Hive<int> hive;
+    for (int i{0}; i < 1024; i++)
+        hive.insert(i);
+    auto first = hive.begin();
+    const int* first_address = &*first;
+    auto last_of_first_block = hive.get_iterator(first_address + 1023);
+
+    // 5 more blocks: the vector of blocks reallocates several times
+    std::vector<Hive<int>::iterator> inserted;
+    for (int i{1024}; i < 6024; i++)
+        inserted.push_back(hive.insert(i));
+
+    check(&*first == first_address && *first == 0, "begin() taken before the inserts still points at 0");
+    check(*last_of_first_block == 1023, "iterator to the last slot of the first block");
+    ++last_of_first_block;
+    check(last_of_first_block != hive.end() && *last_of_first_block == 1024, "++ crosses into a block added later");
+
+    long long sum{0};
+    std::size_t count{0};
+    for (auto it = first; it != hive.end(); ++it) {
+        sum += *it;
+        ++count;
+    }
+    check(count == 6024, "iterating from the old begin() visits every element");
+    check(sum == 6023LL * 6024 / 2, "iterating from the old begin() sees every value");
+
+    bool inserted_ok{true};
+    for (std::size_t i{0}; i < inserted.size(); i++)
+        inserted_ok = inserted_ok && *inserted[i] == static_cast<int>(1024 + i);
+    check(inserted_ok, "iterators returned by insert keep their element");
+
+    // end() taken before growing stays the end
+    auto old_end = hive.end();
+    hive.insert(-1);
+    check(old_end == hive.end(), "end() does not change when a block is added");
+
+    // erase through an iterator from before the growth, the slot is reused
+    auto next = hive.erase(first);
+    check(*next == 1, "erase returns the following element");
+    auto reused = hive.insert(7);
+    check(&*reused == first_address, "the erased slot is reused");
+
+    if (failures == 0)
+        std::cout << "hive: all checks passed" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,88 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_17_SMART_POINTERS_WEAK_CACHE_H
+#define SECTION_17_SMART_POINTERS_WEAK_CACHE_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * Cache of shared objects that does not keep them alive.
+ *
+ * The cache only holds weak_ptrs: while somebody uses the object for a key, get() returns
+ * that same object; once the last shared_ptr is gone the object is deleted and its entry
+ * is removed from the cache by the deleter, so expired entries never pile up.
+ */
+template<class Key, class T, class Hash = std::hash<Key>>
+class WeakCache {
+private:
+    struct State {
+        std::mutex mutex;
+        std::unordered_map<Key, std::weak_ptr<T>, Hash> entries;
+    };
+
+    // shared with the deleters, so an object may outlive the cache
+    std::shared_ptr<State> state;
+
+    class Deleter {
+    private:
+        std::weak_ptr<State> state;
+        Key key;
+    public:
+        Deleter(std::weak_ptr<State> state, Key key) : state{std::move(state)}, key{std::move(key)} {}
+
+        void operator()(T* p) {
+            delete p;
+            if (auto s = state.lock()) {
+                std::lock_guard<std::mutex> lock{s->mutex};
+                auto it = s->entries.find(key);
+                // the key may already point to a newer object
+                if (it != s->entries.end() && it->second.expired())
+                    s->entries.erase(it);
+            }
+        }
+    };
+
+public:
+    WeakCache() : state{std::make_shared<State>()} {}
+
+    /**
+     * Returns the live object for key, or creates one with create(), which returns a T* from new.
+     * create() runs without holding the lock.
+     */
+    template<class Factory>
+    std::shared_ptr<T> get(const Key& key, Factory create) {
+        if (auto existing = find(key))
+            return existing;
+
+        std::shared_ptr<T> created{create(), Deleter{state, key}};
+
+        std::lock_guard<std::mutex> lock{state->mutex};
+        std::weak_ptr<T>& entry = state->entries[key];
+        if (auto existing = entry.lock())
+            return existing;    // another thread won the race, ours is deleted on return
+        entry = created;
+        return created;
+    }
+
+    /**
+     * Returns the live object for key, or nullptr
+     */
+    std::shared_ptr<T> find(const Key& key) const {
+        std::lock_guard<std::mutex> lock{state->mutex};
+        auto it = state->entries.find(key);
+        return it == state->entries.end() ? nullptr : it->second.lock();
+    }
+
+    std::size_t size() const {
+        std::lock_guard<std::mutex> lock{state->mutex};
+        return state->entries.size();
+    }
+};
+
+#endif //SECTION_17_SMART_POINTERS_WEAK_CACHE_H
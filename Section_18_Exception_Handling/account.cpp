@@ -4,10 +4,42 @@
 
 #include "account.h"
 
+#include <cmath>
 
 #include "illegal_balance_exception.h"
+#include "insufficient_funds_exception.h"
+
+namespace {
+    // NaN and infinity are not balances, whatever their sign
+    bool legal_balance(double balance) {
+        return std::isfinite(balance) && balance >= 0.0;
+    }
+}
 
 Account::Account(std::string name, double balance) : name{std::move(name)}, balance{balance} {
-    if (balance < 0.0)
-        throw IllegalBalanceException{};
-}
\ No newline at end of file
+    if (!legal_balance(balance))
+        throw IllegalBalanceException{this->name, balance};
+}
+
+Account::Account(Validated, std::string&& name, double balance) noexcept: name{std::move(name)}, balance{balance} {
+}
+
+Result<Account, AccountError> Account::create(std::string name, double balance) noexcept {
+    if (!legal_balance(balance))
+        return Unexpected<AccountError>{AccountError::IllegalBalance};
+    return Result<Account, AccountError>{std::in_place, Validated{}, std::move(name), balance};
+}
+
+void Account::withdraw(double amount) {
+    if (amount > balance)
+        throw InsufficientFundsException{name, amount};
+    balance -= amount;
+}
+
+const std::string& Account::get_name() const {
+    return name;
+}
+
+double Account::get_balance() const {
+    return balance;
+}
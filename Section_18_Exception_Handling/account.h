@@ -8,13 +8,48 @@
 
 #include <string>
 
+#include "result.h"
+
+enum class AccountError {
+    IllegalBalance
+};
+
 class Account {
 private:
     std::string name;
     double balance;
 
+    struct Validated {
+    };
+
+    /**
+     * Used by create(), the balance was already checked
+     */
+    Account(Validated, std::string&& name, double balance) noexcept;
+
+    // create() builds the Account directly inside the Result
+    friend class Result<Account, AccountError>;
+
 public:
+    /**
+     * Throws IllegalBalanceException when balance is negative, NaN or infinite
+     */
     Account(std::string name, double balance);
+
+    /**
+     * Non-throwing alternative to the constructor: returns AccountError::IllegalBalance
+     * instead of throwing when balance is negative, NaN or infinite.
+     */
+    static Result<Account, AccountError> create(std::string name, double balance) noexcept;
+
+    /**
+     * Throws InsufficientFundsException when amount is larger than the balance
+     */
+    void withdraw(double amount);
+
+    const std::string& get_name() const;
+
+    double get_balance() const;
 };
 
 
@@ -0,0 +1,29 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "account_exception.h"
+
+#include <cstdio>
+#include <cstring>
+
+AccountException::AccountException(const char* reason, std::string_view account_id, double amount) noexcept
+        : id{}, offending_amount{amount}, message{} {
+    std::size_t length = account_id.size() < max_id_length ? account_id.size() : max_id_length;
+    std::memcpy(id, account_id.data(), length);
+    id[length] = '\0';
+
+    std::snprintf(message, sizeof(message), "%s (account: %s, amount: %.2f)", reason, id, amount);
+}
+
+const char* AccountException::account_id() const noexcept {
+    return id;
+}
+
+double AccountException::amount() const noexcept {
+    return offending_amount;
+}
+
+const char* AccountException::what() const noexcept {
+    return message;
+}
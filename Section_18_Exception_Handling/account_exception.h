@@ -0,0 +1,50 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_18_EXCEPTION_HANDLING_ACCOUNT_EXCEPTION_H
+#define SECTION_18_EXCEPTION_HANDLING_ACCOUNT_EXCEPTION_H
+
+
+#include <cstddef>
+#include <exception>
+#include <string_view>
+
+/**
+ * Base class of the account exceptions.
+ * Carries the account id and the offending amount in fixed inline buffers, so building,
+ * throwing and copying one never touches the heap (a std::string member would allocate
+ * for long ids, and could throw while copying the exception).
+ * Ids longer than max_id_length are truncated.
+ */
+class AccountException : public std::exception {
+public:
+    static constexpr std::size_t max_id_length{31};
+
+private:
+    char id[max_id_length + 1];
+    double offending_amount;
+    char message[128];
+
+protected:
+    /**
+     * reason is a string literal, e.g. "Illegal balance"
+     */
+    AccountException(const char* reason, std::string_view account_id, double amount) noexcept;
+
+public:
+    AccountException(const AccountException&) noexcept = default;
+
+    AccountException& operator=(const AccountException&) noexcept = default;
+
+    ~AccountException() override = default;
+
+    const char* account_id() const noexcept;
+
+    double amount() const noexcept;
+
+    const char* what() const noexcept override;
+};
+
+
+#endif //SECTION_18_EXCEPTION_HANDLING_ACCOUNT_EXCEPTION_H
@@ -0,0 +1,195 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "account_importer.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+const char* to_string(ImportErrorKind kind) {
+    switch (kind) {
+        case ImportErrorKind::MissingField:
+            return "missing field";
+        case ImportErrorKind::EmptyName:
+            return "empty name";
+        case ImportErrorKind::BadNumber:
+            return "bad number";
+        case ImportErrorKind::IllegalBalance:
+            return "illegal balance";
+    }
+    return "unknown";
+}
+
+// ==== ImportReport ==========================================================
+
+ImportReport::ImportReport(std::size_t max_samples) : max_samples{max_samples} {
+}
+
+void ImportReport::add_error(std::size_t line, ImportErrorKind kind) {
+    ++error_counts[static_cast<int>(kind)];
+    if (samples.size() < max_samples)
+        samples.push_back({line, kind});
+}
+
+std::size_t ImportReport::errors() const {
+    std::size_t total{0};
+    for (auto count: error_counts)
+        total += count;
+    return total;
+}
+
+std::size_t ImportReport::errors(ImportErrorKind kind) const {
+    return error_counts[static_cast<int>(kind)];
+}
+
+const std::vector<ImportError>& ImportReport::error_samples() const {
+    return samples;
+}
+
+void ImportReport::print(std::ostream& os) const {
+    os << "rows: " << rows << ", imported: " << imported << ", errors: " << errors() << "\n";
+    for (int kind{0}; kind < 4; kind++) {
+        if (error_counts[kind] != 0)
+            os << "  " << to_string(static_cast<ImportErrorKind>(kind)) << ": " << error_counts[kind] << "\n";
+    }
+    // balances are checked per batch, after the parse errors: show the samples by line
+    std::vector<ImportError> sorted{samples};
+    std::sort(sorted.begin(), sorted.end(),
+              [](const ImportError& lhs, const ImportError& rhs) { return lhs.line < rhs.line; });
+    for (const auto& error: sorted)
+        os << "  line " << error.line << ": " << to_string(error.kind) << "\n";
+    if (errors() > samples.size())
+        os << "  ... " << errors() - samples.size() << " more\n";
+}
+
+// ==== AccountImporter =======================================================
+
+namespace {
+    std::string_view trim(std::string_view s) {
+        while (!s.empty() && (s.front() == ' ' || s.front() == '\t'))
+            s.remove_prefix(1);
+        while (!s.empty() && (s.back() == ' ' || s.back() == '\t' || s.back() == '\r'))
+            s.remove_suffix(1);
+        return s;
+    }
+}
+
+AccountImporter::AccountImporter(ImportOptions options) : options{options} {
+    if (this->options.batch_size == 0)
+        this->options.batch_size = 1;
+    if (this->options.read_size == 0)
+        this->options.read_size = 1;
+    records.reserve(this->options.batch_size);
+    accounts.reserve(this->options.batch_size);
+}
+
+void AccountImporter::parse_line(std::string_view line, std::size_t line_number, ImportReport& report) {
+    line = trim(line);
+    if (line.empty())
+        return;
+    ++report.rows;
+
+    std::size_t comma = line.find(',');
+    if (comma == std::string_view::npos) {
+        report.add_error(line_number, ImportErrorKind::MissingField);
+        return;
+    }
+
+    std::string_view name = trim(line.substr(0, comma));
+    std::string_view balance_field = trim(line.substr(comma + 1));
+    if (name.empty()) {
+        report.add_error(line_number, ImportErrorKind::EmptyName);
+        return;
+    }
+
+    double balance{0};
+    const char* last = balance_field.data() + balance_field.size();
+    auto [end, ec] = std::from_chars(balance_field.data(), last, balance);
+    // from_chars also reads "nan" and "inf", which are not numbers of an account
+    if (ec != std::errc{} || end != last || balance_field.empty() || !std::isfinite(balance)) {
+        report.add_error(line_number, ImportErrorKind::BadNumber);
+        return;
+    }
+
+    records.push_back({name, balance, line_number});
+}
+
+void AccountImporter::flush(ImportReport& report, const BatchSink& sink) {
+    if (records.empty())
+        return;
+
+    // Account::create is the only judge of a balance, its errors are reported instead of thrown
+    for (const Record& record: records) {
+        Result<Account, AccountError> account = Account::create(std::string{record.name}, record.balance);
+        if (account)
+            accounts.push_back(std::move(account).value());
+        else
+            report.add_error(record.line, ImportErrorKind::IllegalBalance);
+    }
+    report.imported += accounts.size();
+
+    sink(accounts);
+    accounts.clear();
+    records.clear();
+}
+
+ImportReport AccountImporter::import(std::istream& in, const BatchSink& sink) {
+    ImportReport report{options.max_error_samples};
+    std::vector<char> buffer(options.read_size);
+    std::size_t kept{0};        // bytes of an unfinished line kept from the previous read
+    std::size_t line_number{0};
+    bool skip_header = options.has_header;
+
+    for (;;) {
+        if (kept == buffer.size())
+            buffer.resize(buffer.size() * 2);   // a line longer than the buffer
+
+        in.read(buffer.data() + kept, static_cast<std::streamsize>(buffer.size() - kept));
+        std::size_t size = kept + static_cast<std::size_t>(in.gcount());
+        bool at_end = in.gcount() == 0 || !in;
+
+        std::string_view data{buffer.data(), size};
+        std::size_t start{0};
+        for (;;) {
+            std::size_t newline = data.find('\n', start);
+            if (newline == std::string_view::npos)
+                break;
+            ++line_number;
+            if (skip_header)
+                skip_header = false;
+            else
+                parse_line(data.substr(start, newline - start), line_number, report);
+            start = newline + 1;
+
+            if (records.size() == options.batch_size)
+                flush(report, sink);
+        }
+
+        if (at_end) {
+            // last line without a trailing '\n'
+            if (start < size) {
+                ++line_number;
+                if (!skip_header)
+                    parse_line(data.substr(start), line_number, report);
+            }
+            flush(report, sink);
+            return report;
+        }
+
+        // the names point into the buffer: finish the batch before moving the unfinished line
+        flush(report, sink);
+        kept = size - start;
+        std::memmove(buffer.data(), buffer.data() + start, kept);
+    }
+}
+
+ImportReport AccountImporter::import(std::istream& in, std::vector<Account>& out) {
+    return import(in, [&out](std::vector<Account>& batch) {
+        std::move(batch.begin(), batch.end(), std::back_inserter(out));
+    });
+}
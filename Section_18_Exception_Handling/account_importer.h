@@ -0,0 +1,109 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_18_EXCEPTION_HANDLING_ACCOUNT_IMPORTER_H
+#define SECTION_18_EXCEPTION_HANDLING_ACCOUNT_IMPORTER_H
+
+
+#include <cstddef>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "account.h"
+
+enum class ImportErrorKind {
+    MissingField,       // no ',' between name and balance
+    EmptyName,
+    BadNumber,          // balance is not a finite number
+    IllegalBalance      // rejected by Account::create, e.g. negative
+};
+
+const char* to_string(ImportErrorKind kind);
+
+struct ImportError {
+    std::size_t line;
+    ImportErrorKind kind;
+};
+
+/**
+ * Summary of an import: counters for every kind of error plus the first few failing lines,
+ * so a file with millions of bad rows still gives a small report.
+ */
+class ImportReport {
+private:
+    std::size_t error_counts[4]{};
+    std::vector<ImportError> samples;
+    std::size_t max_samples;
+
+public:
+    std::size_t rows{0};
+    std::size_t imported{0};
+
+    explicit ImportReport(std::size_t max_samples = 20);
+
+    void add_error(std::size_t line, ImportErrorKind kind);
+
+    std::size_t errors() const;
+
+    std::size_t errors(ImportErrorKind kind) const;
+
+    const std::vector<ImportError>& error_samples() const;
+
+    void print(std::ostream& os) const;
+};
+
+struct ImportOptions {
+    bool has_header{false};
+    std::size_t batch_size{4096};
+    std::size_t read_size{1 << 20};     // bytes read from the stream at a time
+    std::size_t max_error_samples{20};
+};
+
+/**
+ * Streaming importer for "name,balance" CSV records.
+ *
+ * The input is read in large chunks and split into lines without copying.
+ * Records are parsed into a batch, then every row goes through Account::create and the valid ones
+ * become Accounts (the names are built once and moved in).
+ * Invalid rows are counted in the report instead of stopping the import with an
+ * IllegalBalanceException.
+ */
+class AccountImporter {
+public:
+    /**
+     * Receives every batch of imported accounts; it may move them out
+     */
+    using BatchSink = std::function<void(std::vector<Account>& batch)>;
+
+private:
+    struct Record {
+        std::string_view name;
+        double balance;
+        std::size_t line;
+    };
+
+    ImportOptions options;
+    std::vector<Record> records;
+    std::vector<Account> accounts;
+
+    void parse_line(std::string_view line, std::size_t line_number, ImportReport& report);
+
+    void flush(ImportReport& report, const BatchSink& sink);
+
+public:
+    explicit AccountImporter(ImportOptions options = {});
+
+    ImportReport import(std::istream& in, const BatchSink& sink);
+
+    /**
+     * Appends the imported accounts to out
+     */
+    ImportReport import(std::istream& in, std::vector<Account>& out);
+};
+
+
+#endif //SECTION_18_EXCEPTION_HANDLING_ACCOUNT_IMPORTER_H
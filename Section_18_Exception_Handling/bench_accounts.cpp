@@ -0,0 +1,175 @@
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "alloc_tracker.h"
+#include "benchmark.h"
+#include "account.h"
+#include "account_importer.h"
+#include "illegal_balance_exception.h"
+#include "insufficient_funds_exception.h"
+
+void bm_valid_account(bench::State& state) {
+    while (state.keep_running()) {
+        Account account{"Andres", 1000.0};
+        bench::do_not_optimize(account);
+    }
+}
+BENCHMARK(bm_valid_account);
+
+void bm_invalid_account(bench::State& state) {
+    std::size_t errors{0};
+    while (state.keep_running()) {
+        try {
+            Account account{"Andres", -1000.0};
+            bench::do_not_optimize(account);
+        } catch (const IllegalBalanceException&) {
+            ++errors;
+        }
+    }
+    bench::do_not_optimize(errors);
+}
+BENCHMARK(bm_invalid_account);
+
+/*
+ * With -DCOURSE_ALLOC_TRACKER=ON the number of operator new calls per throw is reported;
+ * it must stay 0 (the exception object itself comes from the runtime's exception buffer).
+ */
+void bm_throw_insufficient_funds(bench::State& state) {
+    Account account{"an_account_id_longer_than_the_small_string_buffer", 100.0};
+#ifdef COURSE_ALLOC_TRACKER
+    const std::size_t allocations_before = alloc_tracker::total_stats().allocations;
+#endif
+    std::size_t errors{0};
+    while (state.keep_running()) {
+        try {
+            account.withdraw(1000.0);
+        } catch (const AccountException& ex) {
+            bench::do_not_optimize(ex.amount());
+            ++errors;
+        }
+    }
+    bench::do_not_optimize(errors);
+#ifdef COURSE_ALLOC_TRACKER
+    const std::size_t allocations = alloc_tracker::total_stats().allocations - allocations_before;
+    state.set_counter("allocs_per_throw", static_cast<double>(allocations) / static_cast<double>(errors));
+#endif
+}
+BENCHMARK(bm_throw_insufficient_funds);
+
+// ==== bulk import ===========================================================
+
+struct Row {
+    std::string name;
+    double balance;
+};
+
+/*
+ * range(0) rows, range(1) of every 1000 with a negative balance.
+ * Built once per invalid rate and shared by the runs.
+ */
+const std::vector<Row>& import_rows(std::size_t count, std::int64_t invalid_per_mille) {
+    static std::vector<Row> rows;
+    static std::int64_t rows_rate{-1};
+    if (rows.size() != count || rows_rate != invalid_per_mille) {
+        rows.clear();
+        rows.reserve(count);
+        std::mt19937 rng{42};
+        std::uniform_int_distribution<int> per_mille{0, 999};
+        for (std::size_t i{0}; i < count; i++) {
+            double balance = per_mille(rng) < invalid_per_mille ? -100.0 : 100.0 + static_cast<double>(i % 1000);
+            rows.push_back({"acct" + std::to_string(i % 100000), balance});
+        }
+        rows_rate = invalid_per_mille;
+    }
+    return rows;
+}
+
+void bm_import_throw(bench::State& state) {
+    const auto& rows = import_rows(static_cast<std::size_t>(state.range(0)), state.range(1));
+    std::size_t valid{0}, invalid{0};
+    while (state.keep_running()) {
+        for (const Row& row: rows) {
+            try {
+                Account account{row.name, row.balance};
+                bench::do_not_optimize(account);
+                ++valid;
+            } catch (const IllegalBalanceException&) {
+                ++invalid;
+            }
+        }
+    }
+    bench::do_not_optimize(valid + invalid);
+    state.set_items_processed(state.iterations() * rows.size());
+}
+BENCHMARK(bm_import_throw)->args({10000000, 0})->args({10000000, 10})->args({10000000, 200})->iterations(1);
+
+void bm_import_result(bench::State& state) {
+    const auto& rows = import_rows(static_cast<std::size_t>(state.range(0)), state.range(1));
+    std::size_t valid{0}, invalid{0};
+    while (state.keep_running()) {
+        for (const Row& row: rows) {
+            Result<Account, AccountError> account = Account::create(row.name, row.balance);
+            bench::do_not_optimize(account);
+            if (account)
+                ++valid;
+            else
+                ++invalid;
+        }
+    }
+    bench::do_not_optimize(valid + invalid);
+    state.set_items_processed(state.iterations() * rows.size());
+}
+BENCHMARK(bm_import_result)->args({10000000, 0})->args({10000000, 10})->args({10000000, 200})->iterations(1);
+
+// ==== CSV import pipeline ===================================================
+
+/*
+ * Writes a CSV file of about range(0) MB (1% invalid rows) once and reads it back in every run.
+ * Pass a larger size to test multi-GB inputs.
+ */
+std::filesystem::path import_file(std::size_t megabytes) {
+    static std::filesystem::path path;
+    static std::size_t written{0};
+    if (written != megabytes) {
+        path = std::filesystem::temp_directory_path() / "section_18_import.csv";
+        std::ofstream out{path, std::ios::binary};
+        std::mt19937 rng{42};
+        std::uniform_int_distribution<int> per_mille{0, 999};
+        std::string line;
+        for (std::size_t bytes{0}, i{0}; bytes < megabytes * 1024 * 1024; i++) {
+            line = "account_" + std::to_string(i) + ',' + (per_mille(rng) < 10 ? "-" : "") +
+                   std::to_string(i % 100000) + ".25\n";
+            out << line;
+            bytes += line.size();
+        }
+        written = megabytes;
+        std::atexit([] { std::filesystem::remove(path); });
+    }
+    return path;
+}
+
+void bm_import_csv(bench::State& state) {
+    const auto path = import_file(static_cast<std::size_t>(state.range(0)));
+    std::size_t rows{0}, bytes{0};
+    while (state.keep_running()) {
+        std::ifstream in{path, std::ios::binary};
+        AccountImporter importer;
+        std::size_t imported{0};
+        ImportReport report = importer.import(in, [&imported](std::vector<Account>& batch) {
+            imported += batch.size();
+        });
+        bench::do_not_optimize(imported);
+        rows += report.rows;
+        bytes += std::filesystem::file_size(path);
+    }
+    state.set_items_processed(rows);
+    state.set_bytes_processed(bytes);
+}
+BENCHMARK(bm_import_csv)->arg(256)->iterations(1);
+
+BENCHMARK_MAIN();
@@ -4,8 +4,9 @@
 
 #include "illegal_balance_exception.h"
 
-#include <string>
+IllegalBalanceException::IllegalBalanceException() noexcept: IllegalBalanceException{"", 0.0} {
+}
 
-const char* IllegalBalanceException::what() const noexcept {
-    return "Illegal balance exception";
+IllegalBalanceException::IllegalBalanceException(std::string_view account_id, double balance) noexcept
+        : AccountException{"Illegal balance exception", account_id, balance} {
 }
@@ -6,16 +6,19 @@
 #define SECTION_18_EXCEPTION_HANDLING_ILLEGAL_BALANCE_EXCEPTION_H
 
 
-#include <exception>
+#include "account_exception.h"
 
-class IllegalBalanceException : public std::exception {
+/**
+ * Thrown when an account would be created with a negative balance
+ */
+class IllegalBalanceException : public AccountException {
 
 public:
-    IllegalBalanceException() noexcept = default;
+    IllegalBalanceException() noexcept;
 
-    ~IllegalBalanceException() override = default;
+    IllegalBalanceException(std::string_view account_id, double balance) noexcept;
 
-    const char* what() const noexcept override;
+    ~IllegalBalanceException() override = default;
 
 
 };
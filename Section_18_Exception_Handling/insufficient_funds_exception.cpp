@@ -0,0 +1,9 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "insufficient_funds_exception.h"
+
+InsufficientFundsException::InsufficientFundsException(std::string_view account_id, double amount) noexcept
+        : AccountException{"Insufficient funds exception", account_id, amount} {
+}
@@ -0,0 +1,23 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_18_EXCEPTION_HANDLING_INSUFFICIENT_FUNDS_EXCEPTION_H
+#define SECTION_18_EXCEPTION_HANDLING_INSUFFICIENT_FUNDS_EXCEPTION_H
+
+
+#include "account_exception.h"
+
+/**
+ * Thrown when a withdrawal is larger than the balance; amount() is the requested withdrawal
+ */
+class InsufficientFundsException : public AccountException {
+
+public:
+    InsufficientFundsException(std::string_view account_id, double amount) noexcept;
+
+    ~InsufficientFundsException() override = default;
+};
+
+
+#endif //SECTION_18_EXCEPTION_HANDLING_INSUFFICIENT_FUNDS_EXCEPTION_H
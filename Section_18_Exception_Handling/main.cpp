@@ -1,8 +1,12 @@
 #include <iostream>
 #include <memory>
+#include <sstream>
+#include <vector>
 
 #include "account.h"
+#include "account_importer.h"
 #include "illegal_balance_exception.h"
+#include "insufficient_funds_exception.h"
 
 int main() {
 
@@ -13,5 +17,34 @@ int main() {
         std::cerr << ex.what() << std::endl;
     }
 
+    try {
+        Account larry_account{"Larry", 100};
+        larry_account.withdraw(500);
+    } catch (const AccountException &ex) { // catches every account exception
+        std::cerr << ex.what() << std::endl;
+        std::cerr << "account: " << ex.account_id() << ", amount: " << ex.amount() << std::endl;
+    }
+
+    // same check without exceptions: the error comes back as a value
+    Result<Account, AccountError> result = Account::create("Andres", -1000);
+    if (result)
+        std::cout << "Use " << result->get_name() << "'s account" << std::endl;
+    else if (result.error() == AccountError::IllegalBalance)
+        std::cerr << "Illegal balance (no exception thrown)" << std::endl;
+
+    // bulk import: bad rows are collected in the report, the import does not stop at the first one
+    std::istringstream csv{"name,balance\n"
+                           "Andres,1000\n"
+                           "Larry,-50\n"
+                           "Moe\n"
+                           "Curly,abc\n"
+                           "Frank,2500.75\n"};
+    std::vector<Account> accounts;
+    AccountImporter importer{ImportOptions{true}};
+    ImportReport report = importer.import(csv, accounts);
+    report.print(std::cout);
+    for (const auto& account: accounts)
+        std::cout << account.get_name() << ": " << account.get_balance() << std::endl;
+
     return 0;
 }
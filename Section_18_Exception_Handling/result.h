@@ -0,0 +1,119 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef SECTION_18_EXCEPTION_HANDLING_RESULT_H
+#define SECTION_18_EXCEPTION_HANDLING_RESULT_H
+
+#include <cassert>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Holds either a value or an error, like C++23 std::expected.
+ * Returning a Result instead of throwing keeps the error path as cheap as the success path,
+ * which matters when errors are common (invalid rows in a bulk import, for example).
+ */
+template<class E>
+class Unexpected {
+private:
+    E error;
+
+    template<class, class>
+    friend class Result;
+
+public:
+    explicit Unexpected(E error) : error{std::move(error)} {}
+};
+
+template<class T, class E>
+class Result {
+private:
+    union {
+        T val;
+        E err;
+    };
+    bool ok;
+
+public:
+    Result(const T& value) : ok{true} { ::new(&val) T(value); }
+
+    Result(T&& value) : ok{true} { ::new(&val) T(std::move(value)); }
+
+    /**
+     * Constructs the value in place, without a temporary to move from
+     */
+    template<class... Args>
+    explicit Result(std::in_place_t, Args&& ... args) : ok{true} { ::new(&val) T(std::forward<Args>(args)...); }
+
+    Result(Unexpected<E> unexpected) : ok{false} { ::new(&err) E(std::move(unexpected.error)); }
+
+    Result(const Result& other) : ok{other.ok} {
+        if (ok)
+            ::new(&val) T(other.val);
+        else
+            ::new(&err) E(other.err);
+    }
+
+    Result(Result&& other) noexcept(std::is_nothrow_move_constructible<T>::value &&
+                                    std::is_nothrow_move_constructible<E>::value) : ok{other.ok} {
+        if (ok)
+            ::new(&val) T(std::move(other.val));
+        else
+            ::new(&err) E(std::move(other.err));
+    }
+
+    Result& operator=(Result other) {
+        this->~Result();
+        ::new(this) Result(std::move(other));
+        return *this;
+    }
+
+    ~Result() {
+        if (ok)
+            val.~T();
+        else
+            err.~E();
+    }
+
+    bool has_value() const noexcept { return ok; }
+
+    explicit operator bool() const noexcept { return ok; }
+
+    /**
+     * The value; only valid when has_value()
+     */
+    T& value() & {
+        assert(ok);
+        return val;
+    }
+
+    const T& value() const& {
+        assert(ok);
+        return val;
+    }
+
+    T&& value() && {
+        assert(ok);
+        return std::move(val);
+    }
+
+    /**
+     * The error; only valid when !has_value()
+     */
+    const E& error() const {
+        assert(!ok);
+        return err;
+    }
+
+    T& operator*() & { return value(); }
+
+    const T& operator*() const& { return value(); }
+
+    T* operator->() { return &value(); }
+
+    const T* operator->() const { return &value(); }
+};
+
+#endif //SECTION_18_EXCEPTION_HANDLING_RESULT_H
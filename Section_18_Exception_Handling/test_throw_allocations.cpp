@@ -0,0 +1,59 @@
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "alloc_tracker.h"
+#include "account.h"
+#include "illegal_balance_exception.h"
+#include "insufficient_funds_exception.h"
+
+/**
+ * Throwing and catching the account exceptions must not call operator new (CTest: Section_18_Throw_Allocations_Test).
+ * The names are longer than the small string buffer, so copying one into an exception would allocate.
+ */
+namespace {
+    constexpr int throws{1000};
+
+    bool check(const char* what, std::size_t allocations) {
+        if (allocations == 0) {
+            std::cout << what << ": 0 allocations in " << throws << " throws" << std::endl;
+            return true;
+        }
+        std::cerr << "FAILED: " << what << ": " << allocations << " allocations in " << throws << " throws" << std::endl;
+        return false;
+    }
+}
+
+int main() {
+    Account account{"an_account_id_longer_than_the_small_string_buffer", 100.0};
+    std::size_t before = alloc_tracker::total_stats().allocations;
+    int caught{0};
+    for (int i{0}; i < throws; i++) {
+        try {
+            account.withdraw(1000.0);
+        } catch (const InsufficientFundsException& ex) {
+            caught += ex.amount() == 1000.0;
+        }
+    }
+    bool passed = check("InsufficientFundsException", alloc_tracker::total_stats().allocations - before);
+
+    // the names are built before counting: moving them into the Account does not allocate
+    std::vector<std::string> names(throws, "another_account_id_longer_than_the_small_string_buffer");
+    before = alloc_tracker::total_stats().allocations;
+    for (auto& name: names) {
+        try {
+            Account invalid{std::move(name), -1000.0};
+        } catch (const IllegalBalanceException& ex) {
+            caught += ex.amount() == -1000.0;
+        }
+    }
+    passed = check("IllegalBalanceException", alloc_tracker::total_stats().allocations - before) && passed;
+
+    if (caught != 2 * throws) {
+        std::cerr << "FAILED: " << caught << " of " << 2 * throws << " exceptions caught" << std::endl;
+        passed = false;
+    }
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+
+#include "async_writer.h"
+#include "benchmark.h"
+#include "field_format.h"
+
+/**
+ * A compute thread producing a fixed-width report: every row needs some math, rows are formatted
+ * into a 4 KB page which is handed to the sink. stall_ms is the time the compute thread spent in the
+ * sink (writes and the final flush) instead of computing.
+ *
+ * range(0): 0 = no sink (compute only), 1 = std::ofstream, 2 = AsyncWriter
+ */
+namespace {
+    constexpr long report_rows{10'000'000};
+
+    template<typename Sink>
+    std::chrono::nanoseconds write_report(Sink&& sink) {
+        const FieldSpec id{12, ' ', Align::Left};
+        const FieldSpec amount{14, ' ', Align::Right, 2, FloatStyle::Fixed};
+        std::chrono::nanoseconds stalled{0};
+        char page[4096];
+        char* end = page;
+        for (long i{0}; i < report_rows; ++i) {
+            const double balance = std::sqrt(static_cast<double>(i)) * 1000.0 + std::sin(i * 0.001);
+            const double interest = balance * std::pow(1.0 + 0.0125, 1 + i % 12);
+            if (page + sizeof page - end < 64) {
+                const auto start = std::chrono::steady_clock::now();
+                sink(page, static_cast<std::size_t>(end - page));
+                stalled += std::chrono::steady_clock::now() - start;
+                end = page;
+            }
+            end = format_field(end, page + sizeof page, static_cast<long long>(i), id);
+            end = format_field(end, page + sizeof page, balance, amount);
+            end = format_field(end, page + sizeof page, interest, amount);
+            *end++ = '\n';
+        }
+        const auto start = std::chrono::steady_clock::now();
+        sink(page, static_cast<std::size_t>(end - page));
+        stalled += std::chrono::steady_clock::now() - start;
+        return stalled;
+    }
+
+    const std::filesystem::path report_path{std::filesystem::temp_directory_path() / "section_19_report.txt"};
+}
+
+void bm_report_writer(bench::State& state) {
+    const auto mode = state.range(0);
+    std::chrono::nanoseconds stalled{0};
+    while (state.keep_running()) {
+        if (mode == 0) {
+            stalled += write_report([](const char* data, std::size_t) { bench::do_not_optimize(data); });
+        } else if (mode == 1) {
+            std::ofstream out{report_path, std::ios::binary};
+            stalled += write_report([&out](const char* data, std::size_t size) { out.write(data, size); });
+            const auto start = std::chrono::steady_clock::now();
+            out.close();
+            stalled += std::chrono::steady_clock::now() - start;
+        } else {
+            AsyncWriter out{report_path.string()};
+            stalled += write_report([&out](const char* data, std::size_t size) { out.write(data, size); });
+            const auto start = std::chrono::steady_clock::now();
+            out.close();
+            stalled += std::chrono::steady_clock::now() - start;
+            state.set_counter("waits", static_cast<double>(out.stall_count()));
+        }
+    }
+    std::filesystem::remove(report_path);
+    state.set_items_processed(state.iterations() * report_rows);
+    state.set_counter("stall_ms", std::chrono::duration<double, std::milli>(stalled).count() /
+                                  static_cast<double>(state.iterations()));
+}
+BENCHMARK(bm_report_writer)->arg(0)->arg(1)->arg(2)->iterations(1);
@@ -0,0 +1,80 @@
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <string>
+
+#include "benchmark.h"
+#include "buffered_writer.h"
+
+/**
+ * Fixed-width report like the one of main: a double and two strings per row,
+ * 50M fields written to the null device
+ */
+namespace {
+    constexpr long field_count{50'000'000};
+    constexpr long row_count{field_count / 3};
+
+#ifdef _WIN32
+    constexpr const char* null_device{"NUL"};
+#else
+    constexpr const char* null_device{"/dev/null"};
+#endif
+
+    const std::string names[]{"Hello", "Checking", "Savings", "Joe"};
+}
+
+void bm_iostream_manipulators(bench::State& state) {
+    std::ofstream out{null_device};
+    while (state.keep_running()) {
+        for (long i{0}; i < row_count; ++i) {
+            const std::string& name = names[i & 3];
+            out << std::setfill('*') << std::setw(10) << i * 0.37
+                << std::setfill('-') << std::setw(10) << std::right << name
+                << std::setw(15) << std::right << name
+                << '\n';
+        }
+        out.flush();
+    }
+    state.set_items_processed(state.iterations() * row_count * 3);
+}
+BENCHMARK(bm_iostream_manipulators)->iterations(1);
+
+void bm_field_format(bench::State& state) {
+    std::FILE* file = std::fopen(null_device, "wb");
+    BufferedWriter out{file};
+    const FieldSpec number{10, '*'};
+    const FieldSpec name_short{10, '-'};
+    const FieldSpec name_long{15, '-'};
+    while (state.keep_running()) {
+        for (long i{0}; i < row_count; ++i) {
+            const std::string& name = names[i & 3];
+            out.write_field(i * 0.37, number)
+                    .write_field(name, name_short)
+                    .write_field(name, name_long) << '\n';
+        }
+        out.flush();
+    }
+    state.set_items_processed(state.iterations() * row_count * 3);
+    std::fclose(file);
+}
+BENCHMARK(bm_field_format)->iterations(1);
+
+void bm_field_format_buffer(bench::State& state) {
+    // formats into a caller-owned buffer, no stream at all
+    char line[64];
+    const FieldSpec number{10, '*'};
+    const FieldSpec name_short{10, '-'};
+    const FieldSpec name_long{15, '-'};
+    while (state.keep_running()) {
+        for (long i{0}; i < row_count; ++i) {
+            const std::string& name = names[i & 3];
+            char* end = format_field(line, line + sizeof line, i * 0.37, number);
+            end = format_field(end, line + sizeof line, name, name_short);
+            end = format_field(end, line + sizeof line, name, name_long);
+            bench::do_not_optimize(end);
+        }
+        bench::clobber_memory();
+    }
+    state.set_items_processed(state.iterations() * row_count * 3);
+}
+BENCHMARK(bm_field_format_buffer)->iterations(1);
@@ -0,0 +1,4 @@
+#include "benchmark.h"
+
+// the benchmarks register themselves from the bench_*.cpp files of the section
+BENCHMARK_MAIN();
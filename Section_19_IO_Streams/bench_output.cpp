@@ -0,0 +1,67 @@
+#include <cstdio>
+#include <fstream>
+
+#include "benchmark.h"
+#include "buffered_writer.h"
+
+/**
+ * 10M log lines like the ones the course classes print, written to the null device
+ * so only the formatting and the write calls are measured
+ */
+namespace {
+    constexpr long line_count{10'000'000};
+
+#ifdef _WIN32
+    constexpr const char* null_device{"NUL"};
+#else
+    constexpr const char* null_device{"/dev/null"};
+#endif
+}
+
+void bm_ostream_endl(bench::State& state) {
+    std::ofstream out{null_device};
+    while (state.keep_running()) {
+        for (long i{0}; i < line_count; ++i)
+            out << "Account " << i << " balance " << i * 0.5 << std::endl;
+    }
+    state.set_items_processed(state.iterations() * line_count);
+}
+BENCHMARK(bm_ostream_endl)->iterations(1);
+
+void bm_ostream_newline(bench::State& state) {
+    std::ofstream out{null_device};
+    while (state.keep_running()) {
+        for (long i{0}; i < line_count; ++i)
+            out << "Account " << i << " balance " << i * 0.5 << '\n';
+        out.flush();
+    }
+    state.set_items_processed(state.iterations() * line_count);
+}
+BENCHMARK(bm_ostream_newline)->iterations(1);
+
+void bm_redirected_ostream_endl(bench::State& state) {
+    std::FILE* file = std::fopen(null_device, "wb");
+    BufferedWriter writer{file};
+    std::ostream out{&writer};
+    while (state.keep_running()) {
+        for (long i{0}; i < line_count; ++i)
+            out << "Account " << i << " balance " << i * 0.5 << std::endl;
+        writer.flush();
+    }
+    state.set_items_processed(state.iterations() * line_count);
+    std::fclose(file);
+}
+BENCHMARK(bm_redirected_ostream_endl)->iterations(1);
+
+void bm_buffered_writer(bench::State& state) {
+    std::FILE* file = std::fopen(null_device, "wb");
+    BufferedWriter out{file};
+    while (state.keep_running()) {
+        for (long i{0}; i < line_count; ++i)
+            out << "Account " << i << " balance " << i * 0.5 << '\n';
+        out.flush();
+    }
+    state.set_items_processed(state.iterations() * line_count);
+    std::fclose(file);
+}
+BENCHMARK(bm_buffered_writer)->iterations(1);
@@ -0,0 +1,95 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "benchmark.h"
+#include "buffered_writer.h"
+#include "file_reader.h"
+
+/**
+ * Writes a text file of about range(0) MB once and reads it back in every run,
+ * lines look like "account_42 1234.25 Savings"
+ */
+std::filesystem::path input_file(std::size_t megabytes) {
+    static std::filesystem::path path;
+    static std::size_t written{0};
+    if (written != megabytes) {
+        path = std::filesystem::temp_directory_path() / "section_19_input.txt";
+        std::FILE* file = std::fopen(path.string().c_str(), "wb");
+        {
+            BufferedWriter out{file};
+            const char* kinds[]{"Checking", "Savings", "Trust"};
+            const std::size_t bytes = megabytes * 1024 * 1024;
+            for (long long i{0}; (i & 4095) != 0 || static_cast<std::size_t>(std::ftell(file)) < bytes; i++)
+                out << "account_" << i << ' ' << (i % 100000) * 0.25 << ' ' << kinds[i % 3] << '\n';
+        }
+        std::fclose(file);
+        written = megabytes;
+        std::atexit([] { std::filesystem::remove(path); });
+    }
+    return path;
+}
+
+void bm_ifstream_getline(bench::State& state) {
+    const auto path = input_file(static_cast<std::size_t>(state.range(0)));
+    std::size_t lines{0}, bytes{0};
+    while (state.keep_running()) {
+        std::ifstream in{path, std::ios::binary};
+        std::string line;
+        while (std::getline(in, line)) {
+            bytes += line.size() + 1;
+            ++lines;
+        }
+    }
+    state.set_items_processed(lines);
+    state.set_bytes_processed(bytes);
+}
+BENCHMARK(bm_ifstream_getline)->arg(5120)->iterations(1);
+
+void bm_file_reader_lines(bench::State& state) {
+    const auto path = input_file(static_cast<std::size_t>(state.range(0)));
+    const bool allow_mmap = state.range(1) != 0;
+    std::size_t lines{0}, bytes{0};
+    while (state.keep_running()) {
+        FileReader reader{path.string(), allow_mmap};
+        for (std::string_view line: reader.lines()) {
+            bytes += line.size() + 1;
+            ++lines;
+        }
+    }
+    state.set_items_processed(lines);
+    state.set_bytes_processed(bytes);
+}
+BENCHMARK(bm_file_reader_lines)->args({5120, 1})->args({5120, 0})->iterations(1);
+
+void bm_ifstream_tokens(bench::State& state) {
+    const auto path = input_file(static_cast<std::size_t>(state.range(0)));
+    std::size_t tokens{0}, bytes{0};
+    while (state.keep_running()) {
+        std::ifstream in{path, std::ios::binary};
+        std::string token;
+        while (in >> token) {
+            bytes += token.size();
+            ++tokens;
+        }
+    }
+    state.set_items_processed(tokens);
+    state.set_bytes_processed(bytes);
+}
+BENCHMARK(bm_ifstream_tokens)->arg(5120)->iterations(1);
+
+void bm_file_reader_tokens(bench::State& state) {
+    const auto path = input_file(static_cast<std::size_t>(state.range(0)));
+    std::size_t tokens{0}, bytes{0};
+    while (state.keep_running()) {
+        FileReader reader{path.string()};
+        for (std::string_view token: reader.tokens()) {
+            bytes += token.size();
+            ++tokens;
+        }
+    }
+    state.set_items_processed(tokens);
+    state.set_bytes_processed(bytes);
+}
+BENCHMARK(bm_file_reader_tokens)->arg(5120)->iterations(1);
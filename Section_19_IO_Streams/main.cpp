@@ -1,6 +1,13 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <iomanip>
 
+#include "async_writer.h"
+#include "buffered_writer.h"
+#include "file_reader.h"
+
 int main() {
     double num{1234.5678};
     std::string hello{"Hello"};
@@ -9,5 +16,57 @@ int main() {
               << std::setfill('-') << std::setw(10) << std::right << hello
               << std::setw(15) << std::right << hello
               << std::endl;
+
+    /**
+     * The same layout with the field formatter: one FieldSpec per column instead of the manipulators
+     */
+    BufferedWriter out;
+    out.write_field(num, {10, '*'})
+            .write_field(hello, {10, '-', Align::Right})
+            .write_field(hello, {15, '-', Align::Right}) << '\n';
+    out.write_field(-num, {12, '0', Align::Internal, 2, FloatStyle::Fixed})
+            .write_field(hello, {10, '.', Align::Left})
+            .write_field(42, {6}) << '\n';
+    out.flush();
+
+    /**
+     * Reading a file: the lines and tokens are views into the mapped file, nothing is copied
+     */
+    const auto path = std::filesystem::temp_directory_path() / "section_19_demo.txt";
+    {
+        std::ofstream file{path};
+        file << "Joe 1234.5 Checking\nMary   99 Savings\n\tTrust 1e6";
+    }
+    {
+        FileReader reader{path.string()};
+        std::cout << "\nmapped: " << std::boolalpha << reader.is_mapped() << std::endl;
+        int n{0};
+        for (std::string_view line: reader.lines())
+            std::cout << "line " << ++n << ": [" << line << "]" << std::endl;
+    }
+    {
+        FileReader reader{path.string(), false};
+        std::cout << "mapped: " << reader.is_mapped() << std::endl;
+        for (std::string_view token: reader.tokens())
+            std::cout << "[" << token << "] ";
+        std::cout << std::endl;
+    }
+
+    /**
+     * Writing a report in the background: this thread only fills buffers, an I/O thread writes them
+     */
+    {
+        AsyncWriter report{path.string()};
+        for (int i{1}; i <= 3; i++)
+            report.write_field(i, {4}).write_field(i * 1000.5, {12, ' ', Align::Right, 2, FloatStyle::Fixed}) << '\n';
+        report.close();
+        std::cout << "report stalls: " << report.stall_count() << std::endl;
+    }
+    {
+        FileReader reader{path.string()};
+        for (std::string_view line: reader.lines())
+            std::cout << "[" << line << "]" << std::endl;
+    }
+    std::filesystem::remove(path);
     return 0;
 }
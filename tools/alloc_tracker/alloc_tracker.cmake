@@ -0,0 +1,38 @@
+# Allocation tracker
+#
+# include() this file from a section CMakeLists.txt and call course_alloc_tracker(<target>).
+# With -DCOURSE_ALLOC_TRACKER=ON the target links the tracker and prints an allocation report at exit.
+# course_alloc_check(<target>) links the tracker whatever the option, for checks that count allocations.
+
+option(COURSE_ALLOC_TRACKER "Track heap allocations of the section executables" OFF)
+
+set(ALLOC_TRACKER_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+if (COURSE_ALLOC_TRACKER AND NOT TARGET alloc_tracker)
+    # object library, so the replacement operator new is always linked in
+    add_library(alloc_tracker OBJECT
+            ${ALLOC_TRACKER_DIR}/alloc_tracker.cpp
+            ${ALLOC_TRACKER_DIR}/alloc_tracker.h
+    )
+    target_include_directories(alloc_tracker PUBLIC ${ALLOC_TRACKER_DIR})
+    target_compile_definitions(alloc_tracker PUBLIC COURSE_ALLOC_TRACKER)
+endif ()
+
+function(course_alloc_tracker target)
+    target_include_directories(${target} PRIVATE ${ALLOC_TRACKER_DIR})
+    if (COURSE_ALLOC_TRACKER)
+        target_link_libraries(${target} PRIVATE alloc_tracker)
+    endif ()
+endfunction()
+
+function(course_alloc_check target)
+    if (NOT TARGET alloc_tracker_check)
+        add_library(alloc_tracker_check OBJECT
+                ${ALLOC_TRACKER_DIR}/alloc_tracker.cpp
+                ${ALLOC_TRACKER_DIR}/alloc_tracker.h
+        )
+        target_include_directories(alloc_tracker_check PUBLIC ${ALLOC_TRACKER_DIR})
+        target_compile_definitions(alloc_tracker_check PUBLIC COURSE_ALLOC_TRACKER)
+    endif ()
+    target_link_libraries(${target} PRIVATE alloc_tracker_check)
+endfunction()
@@ -0,0 +1,215 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "alloc_tracker.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace {
+    constexpr int max_tags{64};
+
+    /*
+     * Every block is prefixed with a header that remembers its size and tag,
+     * so operator delete can update the right counters without a lookup table.
+     * The header keeps the alignment that malloc gives us.
+     */
+    struct alignas(alignof(std::max_align_t)) Header {
+        std::size_t size;
+        int tag;
+    };
+
+    struct Counters {
+        const char* name;
+        std::atomic<std::size_t> allocations;
+        std::atomic<std::size_t> deallocations;
+        std::atomic<std::size_t> bytes;
+        std::atomic<std::size_t> live_bytes;
+        std::atomic<std::size_t> peak_bytes;
+    };
+
+    // zero-initialized before any dynamic initialization, so it is usable from the first new
+    Counters counters[max_tags];
+    Counters total;
+    std::atomic<int> tag_count{1};
+    std::atomic_flag registry_lock = ATOMIC_FLAG_INIT;
+
+    thread_local int current_tag{0};
+
+    void update_peak(Counters& c, std::size_t live) {
+        std::size_t peak = c.peak_bytes.load(std::memory_order_relaxed);
+        while (live > peak && !c.peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+
+    void record_allocation(Counters& c, std::size_t size) {
+        c.allocations.fetch_add(1, std::memory_order_relaxed);
+        c.bytes.fetch_add(size, std::memory_order_relaxed);
+        update_peak(c, c.live_bytes.fetch_add(size, std::memory_order_relaxed) + size);
+    }
+
+    void record_deallocation(Counters& c, std::size_t size) {
+        c.deallocations.fetch_add(1, std::memory_order_relaxed);
+        c.live_bytes.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    void* tracked_allocate(std::size_t size) noexcept {
+        void* block = std::malloc(sizeof(Header) + size);
+        if (block == nullptr)
+            return nullptr;
+
+        Header* header = static_cast<Header*>(block);
+        header->size = size;
+        header->tag = current_tag;
+
+        record_allocation(counters[header->tag], size);
+        record_allocation(total, size);
+
+        return header + 1;
+    }
+
+    void tracked_deallocate(void* ptr) noexcept {
+        if (ptr == nullptr)
+            return;
+
+        Header* header = static_cast<Header*>(ptr) - 1;
+        record_deallocation(counters[header->tag], header->size);
+        record_deallocation(total, header->size);
+
+        std::free(header);
+    }
+
+    void* allocate_or_throw(std::size_t size) {
+        for (;;) {
+            void* ptr = tracked_allocate(size);
+            if (ptr != nullptr)
+                return ptr;
+
+            std::new_handler handler = std::get_new_handler();
+            if (handler == nullptr)
+                throw std::bad_alloc{};
+            handler();
+        }
+    }
+
+    alloc_tracker::Stats to_stats(const Counters& c) {
+        return {
+                c.allocations.load(std::memory_order_relaxed),
+                c.deallocations.load(std::memory_order_relaxed),
+                c.bytes.load(std::memory_order_relaxed),
+                c.live_bytes.load(std::memory_order_relaxed),
+                c.peak_bytes.load(std::memory_order_relaxed)
+        };
+    }
+
+    /*
+     * Prints the report when the static objects are destroyed at exit
+     */
+    struct ExitReport {
+        ~ExitReport() {
+            alloc_tracker::report(stderr);
+        }
+    } exit_report;
+}
+
+int alloc_tracker::register_tag(const char* name) noexcept {
+    while (registry_lock.test_and_set(std::memory_order_acquire)) {
+    }
+
+    int count = tag_count.load(std::memory_order_relaxed);
+    int tag{0};
+    for (int i{1}; i < count && tag == 0; i++) {
+        if (std::strcmp(counters[i].name, name) == 0)
+            tag = i;
+    }
+    if (tag == 0 && count < max_tags) {
+        tag = count;
+        counters[tag].name = name;
+        tag_count.store(count + 1, std::memory_order_release);
+    }
+
+    registry_lock.clear(std::memory_order_release);
+    return tag;
+}
+
+alloc_tracker::Stats alloc_tracker::tag_stats(int tag) noexcept {
+    if (tag < 0 || tag >= tag_count.load(std::memory_order_acquire))
+        return {};
+    return to_stats(counters[tag]);
+}
+
+alloc_tracker::Stats alloc_tracker::total_stats() noexcept {
+    return to_stats(total);
+}
+
+void alloc_tracker::report(std::FILE* out) noexcept {
+    std::fprintf(out, "\n=== Allocation report ====================================================\n");
+    std::fprintf(out, "%-24s %12s %12s %14s %12s %12s\n", "tag", "allocs", "frees", "bytes", "live", "peak");
+
+    int count = tag_count.load(std::memory_order_acquire);
+    for (int i{0}; i < count; i++) {
+        Stats s = to_stats(counters[i]);
+        if (s.allocations == 0)
+            continue;
+        std::fprintf(out, "%-24s %12zu %12zu %14zu %12zu %12zu\n", i == 0 ? "untagged" : counters[i].name,
+                     s.allocations, s.deallocations, s.bytes, s.live_bytes, s.peak_bytes);
+    }
+
+    Stats s = to_stats(total);
+    std::fprintf(out, "%-24s %12zu %12zu %14zu %12zu %12zu\n", "TOTAL",
+                 s.allocations, s.deallocations, s.bytes, s.live_bytes, s.peak_bytes);
+}
+
+alloc_tracker::Scope::Scope(int tag) noexcept: previous{current_tag} {
+    current_tag = tag;
+}
+
+alloc_tracker::Scope::~Scope() {
+    current_tag = previous;
+}
+
+// ==== Replacement of the global allocation functions ========================
+
+void* operator new(std::size_t size) {
+    return allocate_or_throw(size);
+}
+
+void* operator new[](std::size_t size) {
+    return allocate_or_throw(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return tracked_allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return tracked_allocate(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    tracked_deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    tracked_deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    tracked_deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    tracked_deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    tracked_deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    tracked_deallocate(ptr);
+}
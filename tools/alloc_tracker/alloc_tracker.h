@@ -0,0 +1,80 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef TOOLS_ALLOC_TRACKER_H
+#define TOOLS_ALLOC_TRACKER_H
+
+#include <cstddef>
+#include <cstdio>
+
+/**
+ * Allocation tracker.
+ * When linked into an executable it replaces the global operator new / delete and counts,
+ * for every tag, the allocations, the bytes requested and the peak of live bytes.
+ * A report is written to stderr when the program exits.
+ *
+ * Allocations are attributed to the innermost ALLOC_TRACKER_SCOPE of the current thread,
+ * or to "untagged" when there is none.
+ *
+ * The tracker is only compiled in when the COURSE_ALLOC_TRACKER CMake option is ON,
+ * otherwise ALLOC_TRACKER_SCOPE expands to nothing.
+ */
+namespace alloc_tracker {
+
+    struct Stats {
+        std::size_t allocations;
+        std::size_t deallocations;
+        std::size_t bytes;          // total bytes requested
+        std::size_t live_bytes;     // bytes currently allocated
+        std::size_t peak_bytes;     // maximum of live_bytes
+    };
+
+    /**
+     * Returns the id of the tag with the given name, registering it if needed.
+     * Returns 0 ("untagged") when the tag table is full.
+     */
+    int register_tag(const char* name) noexcept;
+
+    /**
+     * Counters of a single tag
+     */
+    Stats tag_stats(int tag) noexcept;
+
+    /**
+     * Counters of all the tags combined
+     */
+    Stats total_stats() noexcept;
+
+    /**
+     * Writes the report table to the given file
+     */
+    void report(std::FILE* out) noexcept;
+
+    /**
+     * RAII guard that attributes the allocations of the current thread to a tag
+     * until it goes out of scope.
+     */
+    class Scope {
+    private:
+        int previous;
+    public:
+        explicit Scope(int tag) noexcept;
+
+        Scope(const Scope&) = delete;
+
+        Scope& operator=(const Scope&) = delete;
+
+        ~Scope();
+    };
+}
+
+#ifdef COURSE_ALLOC_TRACKER
+#define ALLOC_TRACKER_SCOPE(tag) \
+    static const int alloc_tracker_tag_ = alloc_tracker::register_tag(tag); \
+    alloc_tracker::Scope alloc_tracker_scope_{alloc_tracker_tag_}
+#else
+#define ALLOC_TRACKER_SCOPE(tag) ((void) 0)
+#endif
+
+#endif //TOOLS_ALLOC_TRACKER_H
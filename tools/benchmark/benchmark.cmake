@@ -0,0 +1,30 @@
+# Benchmark harness
+#
+# include() this file from a section CMakeLists.txt and call
+# course_benchmark(<name> <sources>...) to add a benchmark executable.
+# Benchmarks are skipped with -DCOURSE_BENCHMARKS=OFF.
+
+option(COURSE_BENCHMARKS "Build the benchmark executables of the sections" ON)
+
+set(BENCHMARK_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+if (COURSE_BENCHMARKS AND NOT TARGET benchmark_harness)
+    find_package(Threads REQUIRED)
+
+    add_library(benchmark_harness STATIC
+            ${BENCHMARK_DIR}/benchmark.cpp
+            ${BENCHMARK_DIR}/benchmark.h
+    )
+    target_include_directories(benchmark_harness PUBLIC ${BENCHMARK_DIR})
+    target_compile_features(benchmark_harness PUBLIC cxx_std_17)
+    target_link_libraries(benchmark_harness PUBLIC Threads::Threads)
+endif ()
+
+function(course_benchmark name)
+    if (NOT COURSE_BENCHMARKS)
+        return()
+    endif ()
+    add_executable(${name} ${ARGN})
+    target_link_libraries(${name} PRIVATE benchmark_harness)
+    course_alloc_tracker(${name})
+endfunction()
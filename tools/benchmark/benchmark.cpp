@@ -0,0 +1,523 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "benchmark.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+#include <thread>
+#include <utility>
+
+#if defined(__linux__) && __has_include(<linux/perf_event.h>)
+#define BENCHMARK_HAS_PERF 1
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#define BENCHMARK_HAS_PERF 0
+#endif
+
+namespace bench {
+
+    // ==== State =================================================================
+
+    State::State(std::size_t iterations, std::vector<std::int64_t> args, int thread_index, int thread_count,
+                 std::atomic<int>* ready)
+            : max_iterations{iterations}, remaining{iterations}, args{std::move(args)},
+              index{thread_index}, count{thread_count}, ready{ready} {
+    }
+
+    void State::begin() {
+        started = true;
+        if (count > 1) {
+            // every thread starts measuring at the same time
+            ready->fetch_add(1);
+            while (ready->load() < count)
+                std::this_thread::yield();
+        }
+        start = Clock::now();
+    }
+
+    void State::finish() {
+        if (!started || elapsed != Clock::duration::zero())
+            return;
+        if (paused)
+            resume_timing();
+        elapsed = Clock::now() - start - paused_time;
+    }
+
+    void State::pause_timing() {
+        paused = true;
+        pause_start = Clock::now();
+    }
+
+    void State::resume_timing() {
+        paused = false;
+        paused_time += Clock::now() - pause_start;
+    }
+
+    // ==== Benchmark =============================================================
+
+    Benchmark::Benchmark(std::string name, Function function) : name{std::move(name)}, function{function} {
+    }
+
+    Benchmark* Benchmark::arg(std::int64_t value) {
+        arg_sets.push_back({value});
+        return this;
+    }
+
+    Benchmark* Benchmark::args(std::vector<std::int64_t> values) {
+        arg_sets.push_back(std::move(values));
+        return this;
+    }
+
+    Benchmark* Benchmark::range(std::int64_t start, std::int64_t limit, std::int64_t multiplier) {
+        for (std::int64_t value{start}; value <= limit; value *= multiplier) {
+            arg(value);
+            if (multiplier <= 1)
+                break;
+        }
+        return this;
+    }
+
+    Benchmark* Benchmark::threads(int n) {
+        thread_counts.push_back(n);
+        return this;
+    }
+
+    Benchmark* Benchmark::iterations(std::size_t n) {
+        fixed_iterations = n;
+        return this;
+    }
+
+    namespace {
+        std::vector<std::unique_ptr<Benchmark>>& registry() {
+            static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+            return benchmarks;
+        }
+    }
+
+    Benchmark* register_benchmark(const char* name, Function function) {
+        registry().push_back(std::make_unique<Benchmark>(name, function));
+        return registry().back().get();
+    }
+
+    // ==== Hardware counters =====================================================
+
+    namespace {
+        struct PerfEvent {
+            const char* name;
+            std::uint32_t type;
+            std::uint64_t config;
+        };
+
+        class PerfCounters {
+        private:
+            std::vector<int> fds;
+            std::vector<const char*> event_names;
+        public:
+            PerfCounters() = default;
+
+            PerfCounters(const PerfCounters&) = delete;
+
+            PerfCounters& operator=(const PerfCounters&) = delete;
+
+            ~PerfCounters() {
+#if BENCHMARK_HAS_PERF
+                for (int fd: fds)
+                    close(fd);
+#endif
+            }
+
+            /**
+             * Opens the counters, returns false when the kernel does not allow it
+             */
+            bool open() {
+#if BENCHMARK_HAS_PERF
+                const PerfEvent events[]{
+                        {"cycles",        PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+                        {"instructions",  PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+                        {"cache-misses",  PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+                        {"branch-misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+                };
+                for (const auto& event: events) {
+                    perf_event_attr attr{};
+                    attr.size = sizeof(attr);
+                    attr.type = event.type;
+                    attr.config = event.config;
+                    attr.disabled = 1;
+                    attr.inherit = 1;       // also count the threads started by the benchmark
+                    attr.exclude_kernel = 1;
+                    attr.exclude_hv = 1;
+                    int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+                    if (fd < 0)
+                        continue;
+                    fds.push_back(fd);
+                    event_names.push_back(event.name);
+                }
+#endif
+                return !fds.empty();
+            }
+
+            const std::vector<const char*>& names() const { return event_names; }
+
+            void start() {
+#if BENCHMARK_HAS_PERF
+                for (int fd: fds) {
+                    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+#endif
+            }
+
+            std::vector<double> stop() {
+                std::vector<double> values;
+#if BENCHMARK_HAS_PERF
+                for (int fd: fds)
+                    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+                for (int fd: fds) {
+                    std::uint64_t value{0};
+                    if (read(fd, &value, sizeof(value)) != sizeof(value))
+                        value = 0;
+                    values.push_back(static_cast<double>(value));
+                }
+#endif
+                return values;
+            }
+        };
+
+        /*
+         * Discards everything, used to silence the logging of the course classes
+         */
+        class NullBuffer : public std::streambuf {
+        protected:
+            int_type overflow(int_type c) override { return traits_type::not_eof(c); }
+
+            std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+        };
+    }
+
+    // ==== Runner ================================================================
+
+    struct Options {
+        std::string filter;
+        double min_time{0.1};
+        int repetitions{5};
+        int warmup{1};
+        std::string json_file;
+        bool perf{true};
+        bool verbose{false};
+    };
+
+    struct Summary {
+        double mean;
+        double median;
+        double stddev;
+        double min;
+        double max;
+    };
+
+    struct Result {
+        std::string name;
+        std::size_t iterations;
+        int threads;
+        Summary time_ns;    // per iteration
+        double items_per_second;
+        double bytes_per_second;
+        std::map<std::string, double> counters;
+    };
+
+    class Runner {
+    private:
+        const Options& options;
+        PerfCounters perf;
+        bool perf_enabled{false};
+
+        struct Run {
+            double seconds;
+            std::size_t iterations;
+            std::size_t items;
+            std::size_t bytes;
+            std::map<std::string, double> counters;
+            std::vector<double> perf_values;
+        };
+
+        Run run_once(const Benchmark& benchmark, const std::vector<std::int64_t>& args, int threads,
+                     std::size_t iterations) {
+            std::atomic<int> ready{0};
+            std::vector<State> states;
+            states.reserve(threads);
+            for (int i{0}; i < threads; i++)
+                states.emplace_back(iterations, args, i, threads, &ready);
+
+            if (perf_enabled)
+                perf.start();
+
+            if (threads == 1) {
+                benchmark.function(states[0]);
+            } else {
+                std::vector<std::thread> workers;
+                for (int i{0}; i < threads; i++)
+                    workers.emplace_back(benchmark.function, std::ref(states[i]));
+                for (auto& worker: workers)
+                    worker.join();
+            }
+
+            Run run{0.0, iterations, 0, 0, states[0].counters, {}};
+            if (perf_enabled)
+                run.perf_values = perf.stop();
+
+            for (auto& state: states) {
+                state.finish();
+                run.seconds = std::max(run.seconds, std::chrono::duration<double>(state.elapsed).count());
+                run.items += state.items;
+                run.bytes += state.bytes;
+            }
+            return run;
+        }
+
+        static Summary summarize(std::vector<double> values) {
+            std::sort(values.begin(), values.end());
+            const auto n = static_cast<double>(values.size());
+
+            double sum{0};
+            for (double v: values)
+                sum += v;
+            double mean = sum / n;
+
+            double squares{0};
+            for (double v: values)
+                squares += (v - mean) * (v - mean);
+
+            std::size_t middle = values.size() / 2;
+            double median = values.size() % 2 == 1 ? values[middle] : (values[middle - 1] + values[middle]) / 2;
+
+            return {mean, median, values.size() > 1 ? std::sqrt(squares / (n - 1)) : 0.0, values.front(),
+                    values.back()};
+        }
+
+    public:
+        explicit Runner(const Options& options) : options{options} {
+            if (options.perf)
+                perf_enabled = perf.open();
+        }
+
+        bool has_perf() const { return perf_enabled; }
+
+        Result run(const Benchmark& benchmark, const std::string& name, const std::vector<std::int64_t>& args,
+                   int threads) {
+            // calibration, also warms up caches and the allocator
+            std::size_t iterations{benchmark.fixed_iterations == 0 ? 1 : benchmark.fixed_iterations};
+            while (benchmark.fixed_iterations == 0) {
+                Run run = run_once(benchmark, args, threads, iterations);
+                if (run.seconds >= options.min_time || iterations >= 1000000000)
+                    break;
+                double multiplier = run.seconds <= 0.0 ? 10.0 : options.min_time * 1.4 / run.seconds;
+                multiplier = std::min(10.0, std::max(multiplier, 1.0));
+                iterations = std::max(iterations + 1, static_cast<std::size_t>(iterations * multiplier));
+            }
+
+            for (int i{0}; i < options.warmup; i++)
+                run_once(benchmark, args, threads, iterations);
+
+            std::vector<double> times;
+            std::map<std::string, std::vector<double>> counter_values;
+            double items{0}, bytes{0}, seconds{0};
+            for (int i{0}; i < options.repetitions; i++) {
+                Run run = run_once(benchmark, args, threads, iterations);
+                times.push_back(run.seconds * 1e9 / static_cast<double>(run.iterations));
+                items += static_cast<double>(run.items);
+                bytes += static_cast<double>(run.bytes);
+                seconds += run.seconds;
+                for (const auto& counter: run.counters)
+                    counter_values[counter.first].push_back(counter.second);
+                for (std::size_t e{0}; e < run.perf_values.size(); e++)
+                    counter_values[std::string{perf.names()[e]} + "/iter"].push_back(
+                            run.perf_values[e] / static_cast<double>(run.iterations));
+            }
+
+            Result result{name, iterations, threads, summarize(times),
+                          seconds > 0 ? items / seconds : 0.0, seconds > 0 ? bytes / seconds : 0.0, {}};
+            for (const auto& counter: counter_values)
+                result.counters[counter.first] = summarize(counter.second).mean;
+            return result;
+        }
+    };
+
+    // ==== Output ================================================================
+
+    namespace {
+        std::string human(double value) {
+            const char* suffixes[]{"", "k", "M", "G", "T"};
+            int i{0};
+            while (std::fabs(value) >= 1000.0 && i < 4) {
+                value /= 1000.0;
+                ++i;
+            }
+            std::ostringstream os;
+            os << std::fixed << std::setprecision(value < 10 ? 2 : 1) << value << suffixes[i];
+            return os.str();
+        }
+
+        void print_header(std::ostream& os) {
+            os << std::left << std::setw(48) << "Benchmark" << std::right
+               << std::setw(14) << "Mean(ns)" << std::setw(14) << "Median(ns)" << std::setw(10) << "CV(%)"
+               << std::setw(13) << "Iterations" << "  Counters\n";
+            os << std::string(110, '-') << '\n';
+        }
+
+        void print_result(std::ostream& os, const Result& r) {
+            double cv = r.time_ns.mean > 0 ? r.time_ns.stddev * 100.0 / r.time_ns.mean : 0.0;
+            os << std::left << std::setw(48) << r.name << std::right << std::fixed << std::setprecision(1)
+               << std::setw(14) << r.time_ns.mean << std::setw(14) << r.time_ns.median
+               << std::setw(10) << cv << std::setw(13) << r.iterations << ' ';
+            if (r.items_per_second > 0)
+                os << " items/s=" << human(r.items_per_second);
+            if (r.bytes_per_second > 0)
+                os << " bytes/s=" << human(r.bytes_per_second);
+            for (const auto& counter: r.counters)
+                os << ' ' << counter.first << '=' << human(counter.second);
+            os << '\n';
+            os.unsetf(std::ios::floatfield);
+        }
+
+        std::string escape(const std::string& s) {
+            std::string out;
+            for (char c: s) {
+                if (c == '"' || c == '\\')
+                    out += '\\';
+                out += c;
+            }
+            return out;
+        }
+
+        void write_json(std::ostream& os, const std::vector<Result>& results, bool perf) {
+            os << std::setprecision(10);
+            os << "{\n  \"context\": {\n"
+               << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n"
+               << "    \"perf_counters\": " << (perf ? "true" : "false") << "\n  },\n"
+               << "  \"benchmarks\": [";
+            for (std::size_t i{0}; i < results.size(); i++) {
+                const Result& r = results[i];
+                os << (i == 0 ? "\n" : ",\n")
+                   << "    {\n"
+                   << "      \"name\": \"" << escape(r.name) << "\",\n"
+                   << "      \"iterations\": " << r.iterations << ",\n"
+                   << "      \"threads\": " << r.threads << ",\n"
+                   << "      \"time_unit\": \"ns\",\n"
+                   << "      \"mean\": " << r.time_ns.mean << ",\n"
+                   << "      \"median\": " << r.time_ns.median << ",\n"
+                   << "      \"stddev\": " << r.time_ns.stddev << ",\n"
+                   << "      \"min\": " << r.time_ns.min << ",\n"
+                   << "      \"max\": " << r.time_ns.max << ",\n"
+                   << "      \"items_per_second\": " << r.items_per_second << ",\n"
+                   << "      \"bytes_per_second\": " << r.bytes_per_second << ",\n"
+                   << "      \"counters\": {";
+                bool first{true};
+                for (const auto& counter: r.counters) {
+                    os << (first ? "" : ", ") << '"' << escape(counter.first) << "\": " << counter.second;
+                    first = false;
+                }
+                os << "}\n    }";
+            }
+            os << "\n  ]\n}\n";
+        }
+
+        bool starts_with(const char* arg, const char* prefix) {
+            return std::strncmp(arg, prefix, std::strlen(prefix)) == 0;
+        }
+
+        Options parse_options(int argc, char** argv) {
+            Options options;
+            for (int i{1}; i < argc; i++) {
+                const char* arg = argv[i];
+                const char* value = std::strchr(arg, '=');
+                value = value == nullptr ? "" : value + 1;
+
+                if (starts_with(arg, "--filter="))
+                    options.filter = value;
+                else if (starts_with(arg, "--min-time="))
+                    options.min_time = std::stod(value);
+                else if (starts_with(arg, "--repetitions="))
+                    options.repetitions = std::max(1, std::stoi(value));
+                else if (starts_with(arg, "--warmup="))
+                    options.warmup = std::max(0, std::stoi(value));
+                else if (starts_with(arg, "--json="))
+                    options.json_file = value;
+                else if (std::strcmp(arg, "--no-perf") == 0)
+                    options.perf = false;
+                else if (std::strcmp(arg, "--verbose") == 0)
+                    options.verbose = true;
+                else
+                    throw std::invalid_argument{std::string{"unknown option "} + arg};
+            }
+            return options;
+        }
+    }
+
+    int run_main(int argc, char** argv) {
+        Options options;
+        try {
+            options = parse_options(argc, argv);
+        } catch (const std::exception& ex) {
+            std::cerr << ex.what() << std::endl;
+            return 1;
+        }
+
+        Runner runner{options};
+        std::cout << "Running " << argv[0] << " (" << std::thread::hardware_concurrency() << " cpus, perf counters "
+                  << (runner.has_perf() ? "on" : "off") << ")\n";
+        print_header(std::cout);
+
+        NullBuffer null_buffer;
+        std::vector<Result> results;
+        for (const auto& benchmark: registry()) {
+            auto arg_sets = benchmark->arg_sets.empty() ? std::vector<std::vector<std::int64_t>>{{}}
+                                                        : benchmark->arg_sets;
+            auto thread_counts = benchmark->thread_counts.empty() ? std::vector<int>{1} : benchmark->thread_counts;
+
+            for (const auto& args: arg_sets) {
+                for (int threads: thread_counts) {
+                    std::string name{benchmark->name};
+                    for (auto a: args)
+                        name += "/" + std::to_string(a);
+                    if (!benchmark->thread_counts.empty())
+                        name += "/threads:" + std::to_string(threads);
+                    if (name.find(options.filter) == std::string::npos)
+                        continue;
+
+                    std::streambuf* cout_buffer = std::cout.rdbuf();
+                    if (!options.verbose)
+                        std::cout.rdbuf(&null_buffer);
+                    Result result = runner.run(*benchmark, name, args, threads);
+                    std::cout.rdbuf(cout_buffer);
+
+                    print_result(std::cout, result);
+                    std::cout.flush();
+                    results.push_back(std::move(result));
+                }
+            }
+        }
+
+        if (!options.json_file.empty()) {
+            std::ofstream json{options.json_file};
+            if (!json) {
+                std::cerr << "Cannot write " << options.json_file << std::endl;
+                return 1;
+            }
+            write_json(json, results, runner.has_perf());
+        }
+        return 0;
+    }
+}
@@ -0,0 +1,196 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef TOOLS_BENCHMARK_H
+#define TOOLS_BENCHMARK_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * Micro-benchmark harness shared by all the sections.
+ * It follows the shape of Google Benchmark:
+ *
+ * void bm_copy(bench::State& state) {
+ *     MyString s{"Hello"};
+ *     while (state.keep_running()) {
+ *         MyString copy{s};
+ *         bench::do_not_optimize(copy);
+ *     }
+ * }
+ * BENCHMARK(bm_copy)->arg(10)->threads(4);
+ *
+ * BENCHMARK_MAIN();
+ *
+ * Every benchmark is calibrated (which also warms it up) until one run takes at least --min-time,
+ * then it is repeated --repetitions times and the mean, median, standard deviation, min and max
+ * of the time per iteration are reported. On Linux, hardware counters are read with perf_event_open
+ * when the kernel allows it.
+ *
+ * Command line options:
+ * --filter=<substring>     only run the benchmarks whose name contains <substring>
+ * --min-time=<seconds>     minimum duration of one measured run (default 0.1)
+ * --repetitions=<n>        measured runs per benchmark (default 5)
+ * --warmup=<n>             extra unmeasured runs after calibration (default 1)
+ * --json=<file>            also write the results as JSON
+ * --no-perf                do not open the hardware counters
+ * --verbose                do not silence std::cout while the benchmarks run
+ */
+namespace bench {
+
+    class State {
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        std::size_t max_iterations;
+        std::size_t remaining;
+        std::vector<std::int64_t> args;
+        int index;
+        int count;
+        std::atomic<int>* ready;
+
+        bool started{false};
+        bool paused{false};
+        Clock::time_point start;
+        Clock::time_point pause_start;
+        Clock::duration paused_time{};
+        Clock::duration elapsed{};
+
+        std::size_t items{0};
+        std::size_t bytes{0};
+        std::map<std::string, double> counters;
+
+        void begin();
+
+        void finish();
+
+        friend class Runner;
+
+    public:
+        State(std::size_t iterations, std::vector<std::int64_t> args, int thread_index, int thread_count,
+              std::atomic<int>* ready);
+
+        /**
+         * Returns true while there are iterations left to run.
+         * The timer starts on the first call and stops when it returns false.
+         */
+        bool keep_running() {
+            if (remaining != 0) {
+                if (!started)
+                    begin();
+                --remaining;
+                return true;
+            }
+            finish();
+            return false;
+        }
+
+        std::size_t iterations() const { return max_iterations; }
+
+        /**
+         * Argument i given with Benchmark::arg / Benchmark::args
+         */
+        std::int64_t range(std::size_t i = 0) const { return args.at(i); }
+
+        int thread_index() const { return index; }
+
+        int threads() const { return count; }
+
+        /**
+         * Excludes setup work inside the loop from the measurement
+         */
+        void pause_timing();
+
+        void resume_timing();
+
+        void set_items_processed(std::size_t n) { items = n; }
+
+        void set_bytes_processed(std::size_t n) { bytes = n; }
+
+        /**
+         * User counter, reported as the mean over the repetitions
+         */
+        void set_counter(const std::string& name, double value) { counters[name] = value; }
+    };
+
+    using Function = void (*)(State&);
+
+    int run_main(int argc, char** argv);
+
+    class Benchmark {
+    private:
+        std::string name;
+        Function function;
+        std::vector<std::vector<std::int64_t>> arg_sets;
+        std::vector<int> thread_counts;
+        std::size_t fixed_iterations{0};
+
+        friend class Runner;
+
+        friend int run_main(int argc, char** argv);
+
+    public:
+        Benchmark(std::string name, Function function);
+
+        Benchmark* arg(std::int64_t value);
+
+        Benchmark* args(std::vector<std::int64_t> values);
+
+        /**
+         * Adds arg(start), arg(start * multiplier), ... up to limit
+         */
+        Benchmark* range(std::int64_t start, std::int64_t limit, std::int64_t multiplier = 10);
+
+        Benchmark* threads(int n);
+
+        /**
+         * Skips the calibration and always runs n iterations.
+         * Useful when one iteration already processes a large data set.
+         */
+        Benchmark* iterations(std::size_t n);
+    };
+
+    Benchmark* register_benchmark(const char* name, Function function);
+
+    /**
+     * Prevents the compiler from optimizing away the computation of value
+     */
+    template<class T>
+    inline void do_not_optimize(T const& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        (void) value;
+#endif
+    }
+
+    /**
+     * Forces pending writes to memory to be considered observable
+     */
+    inline void clobber_memory() {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+}
+
+#define BENCHMARK_CONCAT_(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_(a, b)
+
+#define BENCHMARK(function) \
+    static bench::Benchmark* BENCHMARK_CONCAT(bench_registration_, __LINE__) = \
+        bench::register_benchmark(#function, function)
+
+#define BENCHMARK_MAIN() \
+    int main(int argc, char** argv) { return bench::run_main(argc, argv); }
+
+#endif //TOOLS_BENCHMARK_H
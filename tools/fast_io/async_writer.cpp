@@ -0,0 +1,186 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "async_writer.h"
+
+#include <cerrno>
+#include <iostream>
+#include <stdexcept>
+#include <system_error>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+#ifdef _WIN32
+    int open_write(const char* path) {
+        return _open(path, _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY, _S_IREAD | _S_IWRITE);
+    }
+
+    // only the I/O thread writes, so the file position is always at offset
+    long write_at(int fd, const char* data, std::size_t size, std::uint64_t) {
+        return _write(fd, data, static_cast<unsigned>(size > (1u << 30) ? (1u << 30) : size));
+    }
+
+    void close_file(int fd) { _close(fd); }
+#else
+    int open_write(const char* path) { return ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644); }
+
+    long write_at(int fd, const char* data, std::size_t size, std::uint64_t offset) {
+        return static_cast<long>(::pwrite(fd, data, size, static_cast<off_t>(offset)));
+    }
+
+    void close_file(int fd) { ::close(fd); }
+#endif
+}
+
+AsyncWriter::AsyncWriter(const std::string& path, std::size_t buffer_size, std::size_t buffer_count)
+        : BufferedWriter{nullptr, buffer_size}, fd{open_write(path.c_str())} {
+    if (fd < 0)
+        throw std::system_error{errno, std::generic_category(), path};
+    try {
+        // one buffer is the put area of the writer already
+        for (std::size_t i{1}; i < (buffer_count < 2 ? 2 : buffer_count); i++)
+            free_buffers.emplace_back(capacity());
+        worker = std::thread{&AsyncWriter::run, this};
+    } catch (...) {
+        // the destructor does not run for a constructor that throws
+        close_file(fd);
+        throw;
+    }
+}
+
+AsyncWriter::~AsyncWriter() {
+    try {
+        close();
+    } catch (const std::exception& e) {
+        std::cerr << "AsyncWriter: " << e.what() << std::endl;
+    }
+}
+
+void AsyncWriter::run() {
+    for (;;) {
+        Chunk chunk;
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            work_ready.wait(lock, [this] { return stopping || !queue.empty(); });
+            if (queue.empty())
+                return;
+            chunk = std::move(queue.front());
+            queue.pop_front();
+            writing = true;
+        }
+        write_chunk(chunk);
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            free_buffers.push_back(std::move(chunk.data));
+            writing = false;
+        }
+        buffer_free.notify_all();
+    }
+}
+
+void AsyncWriter::write_chunk(const Chunk& chunk) {
+    if (error != 0)
+        return;
+    std::size_t done{0};
+    while (done < chunk.size) {
+        const long n = write_at(fd, chunk.data.data() + done, chunk.size - done, offset);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0) {
+            std::lock_guard<std::mutex> lock{mutex};
+            error = n < 0 ? errno : EIO;
+            return;
+        }
+        done += static_cast<std::size_t>(n);
+        offset += static_cast<std::uint64_t>(n);
+    }
+}
+
+void AsyncWriter::drain() {
+    if (closed)
+        throw std::logic_error{"AsyncWriter: write after close"};
+    const auto used = static_cast<std::size_t>(pptr() - pbase());
+    if (used == 0)
+        return;
+    std::vector<char> next;
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        if (free_buffers.empty()) {
+            const auto start = std::chrono::steady_clock::now();
+            buffer_free.wait(lock, [this] { return !free_buffers.empty(); });
+            stalled += std::chrono::steady_clock::now() - start;
+            ++stalls;
+        }
+        next = std::move(free_buffers.back());
+        free_buffers.pop_back();
+    }
+    exchange_buffer(next);
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        queue.push_back({std::move(next), used});
+    }
+    work_ready.notify_one();
+}
+
+void AsyncWriter::flush() {
+    if (closed)
+        return;
+    drain();
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        buffer_free.wait(lock, [this] { return queue.empty() && !writing; });
+    }
+    throw_if_failed();
+}
+
+void AsyncWriter::close() {
+    if (closed)
+        return;
+    drain();
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        stopping = true;
+    }
+    work_ready.notify_one();
+    worker.join();
+    close_file(fd);
+    // no room left in the put area: the next write goes to drain(), which refuses it
+    closed = true;
+    setp(pbase(), pbase());
+    throw_if_failed();
+}
+
+void AsyncWriter::throw_if_failed() {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (error != 0)
+        throw std::system_error{error, std::generic_category(), "AsyncWriter write"};
+}
+
+bool AsyncWriter::would_block() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return free_buffers.empty();
+}
+
+std::size_t AsyncWriter::pending_buffers() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return queue.size() + (writing ? 1 : 0);
+}
+
+std::chrono::nanoseconds AsyncWriter::stall_time() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return stalled;
+}
+
+std::size_t AsyncWriter::stall_count() const {
+    std::lock_guard<std::mutex> lock{mutex};
+    return stalls;
+}
@@ -0,0 +1,112 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef TOOLS_FAST_IO_ASYNC_WRITER_H
+#define TOOLS_FAST_IO_ASYNC_WRITER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "buffered_writer.h"
+
+/**
+ * BufferedWriter whose full buffers are written to the file by a background thread:
+ *
+ * AsyncWriter out{"report.txt"};
+ * out.write_field(balance, {10, '*'}) << '\n';
+ *
+ * The writing thread only copies into the current buffer. When it is full it is queued for the
+ * I/O thread (pwrite at the next offset) and an empty one from the pool replaces it.
+ * With buffer_count = 2 that is classic double buffering.
+ *
+ * Backpressure: when the I/O thread is behind and no buffer is free, the writing thread waits.
+ * would_block() tells beforehand, stall_time() / stall_count() tell how long it waited.
+ *
+ * I/O errors are kept and thrown (std::system_error) by the next flush() or close().
+ * Writing after close() throws std::logic_error (through an ostream: badbit).
+ */
+class AsyncWriter : public BufferedWriter {
+private:
+    struct Chunk {
+        std::vector<char> data;
+        std::size_t size;
+    };
+
+    int fd;
+    std::uint64_t offset{0};
+
+    mutable std::mutex mutex;
+    std::condition_variable work_ready;
+    std::condition_variable buffer_free;
+    std::deque<Chunk> queue;
+    std::vector<std::vector<char>> free_buffers;
+    bool writing{false};
+    bool stopping{false};
+    int error{0};
+    bool closed{false};
+
+    std::chrono::nanoseconds stalled{0};
+    std::size_t stalls{0};
+
+    std::thread worker;
+
+    void run();
+
+    void write_chunk(const Chunk& chunk);
+
+    void throw_if_failed();
+
+protected:
+    /**
+     * Queues the full buffer and continues in a free one, waits when there is none
+     */
+    void drain() override;
+
+public:
+    static constexpr std::size_t default_buffer_size{1 << 20};
+
+    /**
+     * Creates or truncates the file, throws std::system_error when it cannot be opened
+     */
+    explicit AsyncWriter(const std::string& path, std::size_t buffer_size = default_buffer_size,
+                         std::size_t buffer_count = 2);
+
+    /**
+     * Closes the file, errors are reported on stderr (call close() to get them as exceptions)
+     */
+    ~AsyncWriter() override;
+
+    /**
+     * Queues the current buffer and waits until everything written so far is in the file
+     */
+    void flush() override;
+
+    /**
+     * Flushes, stops the I/O thread and closes the file. Calling it again does nothing
+     */
+    void close();
+
+    /**
+     * True when filling the current buffer would wait for the I/O thread
+     */
+    bool would_block() const;
+
+    /**
+     * Full buffers waiting for or being written by the I/O thread
+     */
+    std::size_t pending_buffers() const;
+
+    std::chrono::nanoseconds stall_time() const;
+
+    std::size_t stall_count() const;
+};
+
+#endif //TOOLS_FAST_IO_ASYNC_WRITER_H
@@ -0,0 +1,160 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "buffered_writer.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+BufferedWriter::BufferedWriter(std::FILE* file, std::size_t capacity, bool flush_on_sync)
+        : file{file}, buffer(capacity < 64 ? 64 : capacity), flush_on_sync{flush_on_sync} {
+    setp(buffer.data(), buffer.data() + buffer.size());
+}
+
+BufferedWriter::~BufferedWriter() {
+    flush();
+}
+
+void BufferedWriter::drain() {
+    const auto pending = static_cast<std::size_t>(pptr() - pbase());
+    if (pending != 0 && file)
+        std::fwrite(pbase(), 1, pending, file);
+    setp(buffer.data(), buffer.data() + buffer.size());
+}
+
+void BufferedWriter::flush() {
+    drain();
+    if (file)
+        std::fflush(file);
+}
+
+void BufferedWriter::exchange_buffer(std::vector<char>& other) {
+    if (other.size() < buffer.size())
+        other.resize(buffer.size());
+    buffer.swap(other);
+    setp(buffer.data(), buffer.data() + buffer.size());
+}
+
+char* BufferedWriter::reserve(std::size_t n) {
+    if (static_cast<std::size_t>(epptr() - pptr()) < n) {
+        drain();
+        if (buffer.size() < n) {
+            buffer.resize(n);
+            setp(buffer.data(), buffer.data() + buffer.size());
+        }
+    }
+    return pptr();
+}
+
+BufferedWriter::int_type BufferedWriter::overflow(int_type ch) {
+    if (traits_type::eq_int_type(ch, traits_type::eof()))
+        return traits_type::not_eof(ch);
+    *reserve(1) = traits_type::to_char_type(ch);
+    pbump(1);
+    return ch;
+}
+
+std::streamsize BufferedWriter::xsputn(const char* s, std::streamsize n) {
+    write(s, static_cast<std::size_t>(n));
+    return n;
+}
+
+int BufferedWriter::sync() {
+    if (flush_on_sync)
+        flush();
+    return 0;
+}
+
+BufferedWriter& BufferedWriter::write(const char* s, std::size_t n) {
+    while (n > static_cast<std::size_t>(epptr() - pptr())) {
+        // larger than what is left: fill the buffer and drain it piece by piece
+        const auto room = static_cast<std::size_t>(epptr() - pptr());
+        std::memcpy(pptr(), s, room);
+        pbump(static_cast<int>(room));
+        s += room;
+        n -= room;
+        drain();
+    }
+    std::memcpy(pptr(), s, n);
+    pbump(static_cast<int>(n));
+    return *this;
+}
+
+BufferedWriter& BufferedWriter::operator<<(const char* s) {
+    return write(s, std::strlen(s));
+}
+
+BufferedWriter& BufferedWriter::operator<<(char c) {
+    if (pptr() == epptr())
+        reserve(1);
+    *pptr() = c;
+    pbump(1);
+    return *this;
+}
+
+BufferedWriter& BufferedWriter::operator<<(long long value) {
+    char* first = reserve(20);
+    auto result = std::to_chars(first, epptr(), value);
+    pbump(static_cast<int>(result.ptr - first));
+    return *this;
+}
+
+BufferedWriter& BufferedWriter::operator<<(unsigned long long value) {
+    char* first = reserve(20);
+    auto result = std::to_chars(first, epptr(), value);
+    pbump(static_cast<int>(result.ptr - first));
+    return *this;
+}
+
+BufferedWriter& BufferedWriter::operator<<(double value) {
+    // shortest form fits in 24 chars, general form is the digits plus sign, "0.000" or the exponent (8 at most)
+    char* first = reserve(32 + static_cast<std::size_t>(std::max(double_precision, 0)));
+    auto result = double_precision < 0
+                  ? std::to_chars(first, epptr(), value)
+                  : std::to_chars(first, epptr(), value, std::chars_format::general, double_precision);
+    if (result.ec != std::errc{})
+        throw std::length_error{"BufferedWriter: no room for a double"};
+    pbump(static_cast<int>(result.ptr - first));
+    return *this;
+}
+
+BufferedWriter& BufferedWriter::operator<<(const void* p) {
+    char* first = reserve(2 + 16);
+    first[0] = '0';
+    first[1] = 'x';
+    auto result = std::to_chars(first + 2, epptr(), reinterpret_cast<std::uintptr_t>(p), 16);
+    pbump(static_cast<int>(result.ptr - first));
+    return *this;
+}
+
+BufferedWriter& BufferedWriter::write_field(double value, const FieldSpec& spec) {
+    char* first = reserve(max_field_length(value, spec));
+    pbump(static_cast<int>(format_field(first, epptr(), value, spec) - first));
+    return *this;
+}
+
+BufferedWriter& BufferedWriter::write_field(long long value, const FieldSpec& spec) {
+    char* first = reserve(max_field_length(value, spec));
+    pbump(static_cast<int>(format_field(first, epptr(), value, spec) - first));
+    return *this;
+}
+
+BufferedWriter& BufferedWriter::write_field(std::string_view value, const FieldSpec& spec) {
+    char* first = reserve(max_field_length(value, spec));
+    pbump(static_cast<int>(format_field(first, epptr(), value, spec) - first));
+    return *this;
+}
+
+StreamRedirect::StreamRedirect(std::ostream& stream, std::streambuf& buffer)
+        : stream{stream}, previous{stream.rdbuf(&buffer)} {
+}
+
+StreamRedirect::~StreamRedirect() {
+    stream.flush();
+    stream.rdbuf(previous);
+}
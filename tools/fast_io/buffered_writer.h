@@ -0,0 +1,161 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef TOOLS_FAST_IO_BUFFERED_WRITER_H
+#define TOOLS_FAST_IO_BUFFERED_WRITER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "field_format.h"
+
+/**
+ * Output buffer with a large user-space buffer and explicit flushing.
+ *
+ * Two ways to use it:
+ * - directly: writer << "Test destructor (" << data << ")\n";
+ *   numbers are formatted with std::to_chars straight into the buffer, no locale, no iostream state.
+ * - as the buffer of an existing stream (see StreamRedirect): code that writes
+ *   std::cout << ... << std::endl keeps working, but std::endl no longer costs a write per line,
+ *   the buffer goes to the file only when it is full or flush() is called.
+ *
+ * Not thread safe.
+ */
+class BufferedWriter : public std::streambuf {
+private:
+    std::FILE* file;
+    std::vector<char> buffer;
+    bool flush_on_sync;
+    int double_precision{6};
+
+    /**
+     * Makes room for n bytes, returns where to write them
+     */
+    char* reserve(std::size_t n);
+
+protected:
+    /**
+     * Writes out the put area and starts it over, subclasses may hand the buffer elsewhere instead
+     */
+    virtual void drain();
+
+    /**
+     * Makes other the put buffer (empty, at least as large as it is now) and gives back the old one
+     */
+    void exchange_buffer(std::vector<char>& other);
+
+    std::size_t capacity() const { return buffer.size(); }
+
+    int_type overflow(int_type ch) override;
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override;
+
+    /**
+     * Called by std::endl / std::flush: ignored unless flush_on_sync
+     */
+    int sync() override;
+
+public:
+    static constexpr std::size_t default_capacity{1 << 16};
+
+    explicit BufferedWriter(std::FILE* file = stdout, std::size_t capacity = default_capacity,
+                            bool flush_on_sync = false);
+
+    BufferedWriter(const BufferedWriter&) = delete;
+
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+    /**
+     * Flushes what is left
+     */
+    ~BufferedWriter() override;
+
+    /**
+     * Writes the buffer to the file and flushes the file
+     */
+    virtual void flush();
+
+    /**
+     * No double has more significant digits than this in its exact decimal form
+     */
+    static constexpr int max_precision{767};
+
+    /**
+     * Significant digits used for doubles (like std::setprecision, default 6, at most max_precision),
+     * a negative value gives the shortest representation that reads back exactly
+     */
+    void set_precision(int precision) { double_precision = precision < 0 ? -1 : std::min(precision, max_precision); }
+
+    BufferedWriter& write(const char* s, std::size_t n);
+
+    BufferedWriter& operator<<(std::string_view s) { return write(s.data(), s.size()); }
+
+    BufferedWriter& operator<<(const char* s);
+
+    BufferedWriter& operator<<(const std::string& s) { return write(s.data(), s.size()); }
+
+    BufferedWriter& operator<<(char c);
+
+    BufferedWriter& operator<<(int value) { return operator<<(static_cast<long long>(value)); }
+
+    BufferedWriter& operator<<(long value) { return operator<<(static_cast<long long>(value)); }
+
+    BufferedWriter& operator<<(long long value);
+
+    BufferedWriter& operator<<(unsigned value) { return operator<<(static_cast<unsigned long long>(value)); }
+
+    BufferedWriter& operator<<(unsigned long value) { return operator<<(static_cast<unsigned long long>(value)); }
+
+    BufferedWriter& operator<<(unsigned long long value);
+
+    BufferedWriter& operator<<(double value);
+
+    BufferedWriter& operator<<(bool value) { return *this << (value ? "true" : "false"); }
+
+    /**
+     * Pointers are written in hexadecimal, like std::ostream does
+     */
+    BufferedWriter& operator<<(const void* p);
+
+    /**
+     * Writes a value padded to the spec, formatted in place in the buffer
+     */
+    BufferedWriter& write_field(double value, const FieldSpec& spec);
+
+    BufferedWriter& write_field(long long value, const FieldSpec& spec);
+
+    BufferedWriter& write_field(int value, const FieldSpec& spec) {
+        return write_field(static_cast<long long>(value), spec);
+    }
+
+    BufferedWriter& write_field(std::string_view value, const FieldSpec& spec);
+};
+
+/**
+ * Makes a stream write through another buffer until the end of the scope:
+ *
+ * BufferedWriter out;
+ * StreamRedirect redirect{std::cout, out};
+ */
+class StreamRedirect {
+private:
+    std::ostream& stream;
+    std::streambuf* previous;
+public:
+    StreamRedirect(std::ostream& stream, std::streambuf& buffer);
+
+    StreamRedirect(const StreamRedirect&) = delete;
+
+    StreamRedirect& operator=(const StreamRedirect&) = delete;
+
+    ~StreamRedirect();
+};
+
+#endif //TOOLS_FAST_IO_BUFFERED_WRITER_H
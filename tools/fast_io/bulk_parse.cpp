@@ -0,0 +1,43 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "bulk_parse.h"
+
+#include <algorithm>
+
+namespace {
+    bool is_space(char c) {
+        return c == ' ' || (c >= '\t' && c <= '\r');
+    }
+}
+
+std::size_t estimate_number_count(std::string_view text) {
+    const std::size_t sample = std::min<std::size_t>(text.size(), 1 << 16);
+    std::size_t numbers{0};
+    for (std::size_t i{0}; i < sample; i++)
+        if (!is_space(text[i]) && (i + 1 == sample || is_space(text[i + 1])))
+            ++numbers;
+    if (numbers == 0)
+        return 0;
+    // a little slack, a reallocation at the end would copy everything
+    const double bytes_per_number = static_cast<double>(sample) / static_cast<double>(numbers);
+    return static_cast<std::size_t>(static_cast<double>(text.size()) / bytes_per_number * 1.02) + 16;
+}
+
+ParseError make_parse_error(std::string_view text, std::size_t offset, ParseErrorKind kind) {
+    ParseError error;
+    error.kind = kind;
+    // the token of the error, back to its start
+    std::size_t token_begin{offset};
+    while (token_begin > 0 && !is_space(text[token_begin - 1]))
+        --token_begin;
+    std::size_t token_end{offset};
+    while (token_end < text.size() && !is_space(text[token_end]))
+        ++token_end;
+    error.token.assign(text.substr(token_begin, token_end - token_begin));
+    const auto line_begin = text.rfind('\n', token_begin == 0 ? std::string_view::npos : token_begin - 1);
+    error.line = 1 + static_cast<std::size_t>(std::count(text.begin(), text.begin() + token_begin, '\n'));
+    error.column = offset - (line_begin == std::string_view::npos ? 0 : line_begin + 1) + 1;
+    return error;
+}
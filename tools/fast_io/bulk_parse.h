@@ -0,0 +1,91 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef TOOLS_FAST_IO_BULK_PARSE_H
+#define TOOLS_FAST_IO_BULK_PARSE_H
+
+#include <charconv>
+#include <cstddef>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include "number_reader.h"
+
+struct BulkParseStats {
+    std::size_t values{0};
+    std::size_t reserved{0};
+    std::size_t reallocations{0};
+};
+
+/**
+ * Capacity to reserve for the numbers of text, estimated from the bytes per number of its first 64 KB
+ */
+std::size_t estimate_number_count(std::string_view text);
+
+/**
+ * The error for the token at offset of text, with its line and column
+ */
+ParseError make_parse_error(std::string_view text, std::size_t offset, ParseErrorKind kind);
+
+/**
+ * Appends every whitespace separated number of text to out, in one pass:
+ *
+ * FileReader file{"scores.txt"};
+ * std::vector<int> scores;
+ * ParseError error;
+ * if (!parse_all(file.contents(), scores, error))
+ *     std::cerr << error << std::endl;
+ *
+ * The vector is reserved once from an estimate, so it should not reallocate while loading
+ * (stats tells how often it still did). Parsing stops at the first bad token, the numbers before it are kept.
+ */
+template<typename T>
+bool parse_all(std::string_view text, std::vector<T>& out, ParseError& error, BulkParseStats* stats = nullptr) {
+    static_assert(std::is_arithmetic<T>::value, "parse_all reads numbers");
+    const std::size_t first_value = out.size();
+    out.reserve(out.size() + estimate_number_count(text));
+    std::size_t reallocations{0};
+
+    const char* const begin = text.data();
+    const char* const end = begin + text.size();
+    const char* p = begin;
+    bool ok{true};
+    for (;;) {
+        while (p != end && (*p == ' ' || (*p >= '\t' && *p <= '\r')))
+            ++p;
+        if (p == end)
+            break;
+        const char* number = p;
+        if (*p == '+' && p + 1 != end && p[1] != '-')
+            ++number;
+        T value{};
+        const auto result = std::from_chars(number, end, value);
+        if (result.ec != std::errc{}) {
+            error = make_parse_error(text, static_cast<std::size_t>(p - begin),
+                                     result.ec == std::errc::result_out_of_range ? ParseErrorKind::OutOfRange
+                                                                                 : ParseErrorKind::NotANumber);
+            ok = false;
+            break;
+        }
+        p = result.ptr;
+        if (p != end && !(*p == ' ' || (*p >= '\t' && *p <= '\r'))) {
+            error = make_parse_error(text, static_cast<std::size_t>(p - begin), ParseErrorKind::TrailingCharacters);
+            ok = false;
+            break;
+        }
+        if (out.size() == out.capacity())
+            ++reallocations;
+        out.push_back(value);
+    }
+    if (stats) {
+        stats->values = out.size() - first_value;
+        stats->reserved = out.capacity();
+        stats->reallocations = reallocations;
+    }
+    return ok;
+}
+
+#endif //TOOLS_FAST_IO_BULK_PARSE_H
@@ -0,0 +1,35 @@
+# Fast I/O helpers shared by the sections
+#
+# include() this file from a section CMakeLists.txt and call course_fast_io(<target>).
+
+set(FAST_IO_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+if (NOT TARGET fast_io)
+    find_package(Threads REQUIRED)
+
+    add_library(fast_io STATIC
+            ${FAST_IO_DIR}/async_writer.cpp
+            ${FAST_IO_DIR}/async_writer.h
+            ${FAST_IO_DIR}/buffered_writer.cpp
+            ${FAST_IO_DIR}/buffered_writer.h
+            ${FAST_IO_DIR}/bulk_parse.cpp
+            ${FAST_IO_DIR}/bulk_parse.h
+            ${FAST_IO_DIR}/field_format.cpp
+            ${FAST_IO_DIR}/field_format.h
+            ${FAST_IO_DIR}/file_reader.cpp
+            ${FAST_IO_DIR}/file_reader.h
+            ${FAST_IO_DIR}/number_reader.cpp
+            ${FAST_IO_DIR}/number_reader.h
+    )
+    target_include_directories(fast_io PUBLIC ${FAST_IO_DIR})
+    target_compile_features(fast_io PUBLIC cxx_std_17)
+    target_link_libraries(fast_io PUBLIC Threads::Threads)
+endif ()
+
+function(course_fast_io target)
+    # benchmark targets do not exist with -DCOURSE_BENCHMARKS=OFF
+    if (NOT TARGET ${target})
+        return()
+    endif ()
+    target_link_libraries(${target} PRIVATE fast_io)
+endfunction()
@@ -0,0 +1,81 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "field_format.h"
+
+#include <charconv>
+#include <cstring>
+
+namespace {
+    /**
+     * The number is already written at first, moves it to its place in the field and fills the rest
+     */
+    char* pad(char* first, char* end, char* last, const FieldSpec& spec) {
+        const auto length = end - first;
+        if (spec.width <= length)
+            return end;
+        if (last - first < spec.width)
+            return nullptr;
+        const auto padding = spec.width - length;
+        switch (spec.align) {
+            case Align::Left:
+                std::memset(end, spec.fill, padding);
+                break;
+            case Align::Internal:
+                // the sign stays in front of the padding
+                if (*first == '-' || *first == '+') {
+                    std::memmove(first + 1 + padding, first + 1, length - 1);
+                    std::memset(first + 1, spec.fill, padding);
+                    break;
+                }
+                [[fallthrough]];
+            case Align::Right:
+                std::memmove(first + padding, first, length);
+                std::memset(first, spec.fill, padding);
+                break;
+        }
+        return first + spec.width;
+    }
+}
+
+char* format_field(char* first, char* last, double value, const FieldSpec& spec) {
+    std::to_chars_result result{};
+    switch (spec.style) {
+        case FloatStyle::General:
+            result = std::to_chars(first, last, value, std::chars_format::general, spec.precision);
+            break;
+        case FloatStyle::Fixed:
+            result = std::to_chars(first, last, value, std::chars_format::fixed, spec.precision);
+            break;
+        case FloatStyle::Scientific:
+            result = std::to_chars(first, last, value, std::chars_format::scientific, spec.precision);
+            break;
+    }
+    if (result.ec != std::errc{})
+        return nullptr;
+    return pad(first, result.ptr, last, spec);
+}
+
+char* format_field(char* first, char* last, long long value, const FieldSpec& spec) {
+    auto result = std::to_chars(first, last, value);
+    if (result.ec != std::errc{})
+        return nullptr;
+    return pad(first, result.ptr, last, spec);
+}
+
+char* format_field(char* first, char* last, std::string_view value, const FieldSpec& spec) {
+    const auto length = static_cast<std::ptrdiff_t>(value.size());
+    const std::ptrdiff_t field = spec.width > length ? spec.width : length;
+    if (last - first < field)
+        return nullptr;
+    const auto padding = field - length;
+    if (spec.align == Align::Left) {
+        std::memcpy(first, value.data(), value.size());
+        std::memset(first + length, spec.fill, padding);
+    } else {
+        std::memset(first, spec.fill, padding);
+        std::memcpy(first + padding, value.data(), value.size());
+    }
+    return first + field;
+}
@@ -0,0 +1,74 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef TOOLS_FAST_IO_FIELD_FORMAT_H
+#define TOOLS_FAST_IO_FIELD_FORMAT_H
+
+#include <cstddef>
+#include <string_view>
+
+/**
+ * Same meaning as std::left / std::right / std::internal
+ */
+enum class Align {
+    Left,
+    Right,
+    Internal
+};
+
+/**
+ * Same meaning as the defaultfloat / std::fixed / std::scientific manipulators
+ */
+enum class FloatStyle {
+    General,
+    Fixed,
+    Scientific
+};
+
+/**
+ * Layout of one field, the equivalent of the iostream manipulators:
+ *
+ * std::setfill('*') << std::setw(10) << std::right << value
+ * FieldSpec{10, '*', Align::Right}
+ *
+ * Unlike std::setw, the spec is not reset after each field.
+ */
+struct FieldSpec {
+    int width{0};
+    char fill{' '};
+    Align align{Align::Right};
+    int precision{6};
+    FloatStyle style{FloatStyle::General};
+};
+
+/**
+ * Room format_field may need for a double (fixed notation of the largest double plus the decimals)
+ */
+constexpr std::size_t max_field_length(double, const FieldSpec& spec) {
+    const std::size_t digits = 320 + static_cast<std::size_t>(spec.precision < 0 ? 0 : spec.precision);
+    return spec.width > 0 && static_cast<std::size_t>(spec.width) > digits ? spec.width : digits;
+}
+
+constexpr std::size_t max_field_length(long long, const FieldSpec& spec) {
+    return spec.width > 20 ? spec.width : 20;
+}
+
+constexpr std::size_t max_field_length(std::string_view s, const FieldSpec& spec) {
+    return spec.width > 0 && static_cast<std::size_t>(spec.width) > s.size() ? spec.width : s.size();
+}
+
+/**
+ * Formats a value padded to the spec into [first, last) with std::to_chars,
+ * returns the end of the field or nullptr when it does not fit
+ */
+char* format_field(char* first, char* last, double value, const FieldSpec& spec);
+
+char* format_field(char* first, char* last, long long value, const FieldSpec& spec);
+
+/**
+ * The precision does not apply to strings, internal alignment pads like right alignment
+ */
+char* format_field(char* first, char* last, std::string_view value, const FieldSpec& spec);
+
+#endif //TOOLS_FAST_IO_FIELD_FORMAT_H
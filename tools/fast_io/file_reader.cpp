@@ -0,0 +1,164 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "file_reader.h"
+
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+#ifdef _WIN32
+    int open_read(const char* path) { return _open(path, _O_RDONLY | _O_BINARY); }
+
+    long read_some(int fd, char* data, std::size_t size) {
+        return _read(fd, data, static_cast<unsigned>(size > (1u << 30) ? (1u << 30) : size));
+    }
+
+    void close_file(int fd) { _close(fd); }
+#else
+    int open_read(const char* path) { return ::open(path, O_RDONLY); }
+
+    long read_some(int fd, char* data, std::size_t size) {
+        ssize_t n;
+        do {
+            n = ::read(fd, data, size);
+        } while (n < 0 && errno == EINTR);
+        return static_cast<long>(n);
+    }
+
+    void close_file(int fd) { ::close(fd); }
+#endif
+
+    bool is_space(char c) {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+}
+
+FileReader::FileReader(const std::string& path, bool allow_mmap) : fd{open_read(path.c_str())}, owns_fd{true} {
+    if (fd < 0)
+        throw std::system_error{errno, std::generic_category(), path};
+    map_or_buffer(allow_mmap);
+}
+
+FileReader::FileReader(int fd) : fd{fd} {
+    map_or_buffer(true);
+}
+
+FileReader::~FileReader() {
+#ifndef _WIN32
+    if (mapping)
+        ::munmap(mapping, mapping_size);
+#endif
+    if (owns_fd)
+        close_file(fd);
+}
+
+void FileReader::map_or_buffer(bool allow_mmap) {
+#ifndef _WIN32
+    struct stat info{};
+    if (allow_mmap && ::fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+        mapping_size = static_cast<std::size_t>(info.st_size);
+        if (mapping_size == 0) {
+            eof = true;
+            return;
+        }
+        void* data = ::mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data != MAP_FAILED) {
+            ::madvise(data, mapping_size, MADV_SEQUENTIAL);
+            mapping = data;
+            pos = static_cast<const char*>(data);
+            end = pos + mapping_size;
+            eof = true;
+            return;
+        }
+        mapping_size = 0;
+    }
+#endif
+    buffer.resize(default_buffer_size);
+    pos = end = buffer.data();
+}
+
+bool FileReader::refill() {
+    if (eof)
+        return false;
+    // move what is left to the front, grow when it already fills the buffer
+    const auto kept = static_cast<std::size_t>(end - pos);
+    std::memmove(buffer.data(), pos, kept);
+    if (kept == buffer.size())
+        buffer.resize(buffer.size() * 2);
+    pos = buffer.data();
+    end = pos + kept;
+    const long n = read_some(fd, buffer.data() + kept, buffer.size() - kept);
+    if (n < 0)
+        throw std::system_error{errno, std::generic_category(), "FileReader read"};
+    if (n == 0) {
+        eof = true;
+        return false;
+    }
+    end += n;
+    return true;
+}
+
+std::string_view FileReader::contents() {
+    while (refill()) {
+    }
+    std::string_view rest{pos, static_cast<std::size_t>(end - pos)};
+    pos = end;
+    return rest;
+}
+
+bool FileReader::next_line(std::string_view& line) {
+    std::size_t searched{0};
+    for (;;) {
+        const auto* newline = pos + searched == end
+                              ? nullptr
+                              : static_cast<const char*>(std::memchr(pos + searched, '\n', end - pos - searched));
+        if (newline) {
+            line = std::string_view{pos, static_cast<std::size_t>(newline - pos)};
+            pos = newline + 1;
+            return true;
+        }
+        searched = static_cast<std::size_t>(end - pos);
+        if (!refill()) {
+            // last line without '\n'
+            if (pos == end)
+                return false;
+            line = std::string_view{pos, static_cast<std::size_t>(end - pos)};
+            pos = end;
+            return true;
+        }
+    }
+}
+
+bool FileReader::next_token(std::string_view& token) {
+    for (;;) {
+        while (pos != end && is_space(*pos))
+            ++pos;
+        if (pos != end)
+            break;
+        if (!refill())
+            return false;
+    }
+    std::size_t length{1};
+    for (;;) {
+        while (pos + length != end && !is_space(pos[length]))
+            ++length;
+        if (pos + length != end || !refill())
+            break;
+    }
+    token = std::string_view{pos, length};
+    pos += length;
+    return true;
+}
@@ -0,0 +1,135 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef TOOLS_FAST_IO_FILE_READER_H
+#define TOOLS_FAST_IO_FILE_READER_H
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Reads a file by lines or whitespace separated tokens without copying them:
+ *
+ * FileReader reader{"accounts.csv"};
+ * for (std::string_view line: reader.lines())
+ *     ...
+ *
+ * Regular files are memory-mapped, anything else (pipes, terminals, or a failed mmap)
+ * is read with read() into a buffer that grows to hold the longest line.
+ * A view stays valid until the next line / token is read, for a mapped file until the reader is destroyed.
+ *
+ * Throws std::system_error when the file cannot be opened.
+ */
+class FileReader {
+private:
+    int fd{-1};
+    bool owns_fd{false};
+    void* mapping{nullptr};
+    std::size_t mapping_size{0};
+    std::vector<char> buffer;
+    const char* pos{nullptr};
+    const char* end{nullptr};
+    bool eof{false};
+
+    void map_or_buffer(bool allow_mmap);
+
+    /**
+     * Keeps [pos, end) and appends more of the file after it, false at the end of the file
+     */
+    bool refill();
+
+public:
+    static constexpr std::size_t default_buffer_size{1 << 20};
+
+    /**
+     * allow_mmap = false always uses read(), mostly to compare both
+     */
+    explicit FileReader(const std::string& path, bool allow_mmap = true);
+
+    /**
+     * Reads an already open descriptor (for example 0 for stdin), which is not closed
+     */
+    explicit FileReader(int fd);
+
+    FileReader(const FileReader&) = delete;
+
+    FileReader& operator=(const FileReader&) = delete;
+
+    ~FileReader();
+
+    bool is_mapped() const { return mapping != nullptr; }
+
+    /**
+     * The rest of the file as one view, read into memory first when it is not mapped
+     */
+    std::string_view contents();
+
+    /**
+     * The next line without its '\n' (like std::getline), false at the end of the file
+     */
+    bool next_line(std::string_view& line);
+
+    /**
+     * The next run of non-whitespace characters, false at the end of the file
+     */
+    bool next_token(std::string_view& token);
+
+    /**
+     * Input iterator over the lines or tokens, the end iterator has no reader
+     */
+    template<bool (FileReader::*Next)(std::string_view&)>
+    class Iterator {
+    private:
+        FileReader* reader{nullptr};
+        std::string_view current;
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = const std::string_view&;
+
+        Iterator() = default;
+
+        explicit Iterator(FileReader* reader) : reader{reader} { ++*this; }
+
+        reference operator*() const { return current; }
+
+        pointer operator->() const { return &current; }
+
+        Iterator& operator++() {
+            if (!(reader->*Next)(current))
+                reader = nullptr;
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const { return reader == other.reader; }
+
+        bool operator!=(const Iterator& other) const { return reader != other.reader; }
+    };
+
+    using LineIterator = Iterator<&FileReader::next_line>;
+    using TokenIterator = Iterator<&FileReader::next_token>;
+
+    template<typename It>
+    class Range {
+    private:
+        FileReader* reader;
+    public:
+        explicit Range(FileReader* reader) : reader{reader} {}
+
+        It begin() const { return It{reader}; }
+
+        It end() const { return It{}; }
+    };
+
+    Range<LineIterator> lines() { return Range<LineIterator>{this}; }
+
+    Range<TokenIterator> tokens() { return Range<TokenIterator>{this}; }
+};
+
+#endif //TOOLS_FAST_IO_FILE_READER_H
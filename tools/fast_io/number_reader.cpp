@@ -0,0 +1,75 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#include "number_reader.h"
+
+namespace {
+    bool is_space(char c) {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+    }
+
+    const char* describe(ParseErrorKind kind) {
+        switch (kind) {
+            case ParseErrorKind::EndOfInput:
+                return "end of input";
+            case ParseErrorKind::NotANumber:
+                return "not a number";
+            case ParseErrorKind::OutOfRange:
+                return "out of range";
+            case ParseErrorKind::TrailingCharacters:
+                return "unexpected characters";
+        }
+        return "";
+    }
+}
+
+std::ostream& operator<<(std::ostream& os, const ParseError& error) {
+    os << "line " << error.line << ", column " << error.column << ": " << describe(error.kind);
+    if (!error.token.empty())
+        os << " in '" << error.token << "'";
+    return os;
+}
+
+bool NumberReader::next_token(std::string_view& token) {
+    for (;;) {
+        while (cursor < current.size() && is_space(current[cursor]))
+            ++cursor;
+        if (cursor < current.size())
+            break;
+        if (tied)
+            tied->flush();
+        if (!source.next_line(current)) {
+            current = {};
+            cursor = 0;
+            token_column = 0;
+            return false;
+        }
+        ++line_number;
+        cursor = 0;
+    }
+    const std::size_t start{cursor};
+    while (cursor < current.size() && !is_space(current[cursor]))
+        ++cursor;
+    token = current.substr(start, cursor - start);
+    token_column = start + 1;
+    return true;
+}
+
+bool NumberReader::read(char& value) {
+    std::string_view token;
+    if (!next_token(token))
+        return fail(ParseErrorKind::EndOfInput, token, 0);
+    // only one character is taken, the rest of the token is read next
+    cursor = token_column;
+    value = token.front();
+    return true;
+}
+
+bool NumberReader::fail(ParseErrorKind kind, std::string_view token, std::size_t offset) {
+    last_error.kind = kind;
+    last_error.line = line_number;
+    last_error.column = token_column + offset;
+    last_error.token.assign(token.data(), token.size());
+    return false;
+}
@@ -0,0 +1,107 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef TOOLS_FAST_IO_NUMBER_READER_H
+#define TOOLS_FAST_IO_NUMBER_READER_H
+
+#include <charconv>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include "file_reader.h"
+
+enum class ParseErrorKind {
+    EndOfInput,
+    NotANumber,
+    OutOfRange,
+    TrailingCharacters
+};
+
+/**
+ * What went wrong and where, line and column start at 1
+ */
+struct ParseError {
+    ParseErrorKind kind{ParseErrorKind::EndOfInput};
+    std::size_t line{0};
+    std::size_t column{0};
+    std::string token;
+};
+
+std::ostream& operator<<(std::ostream& os, const ParseError& error);
+
+/**
+ * Reads whitespace separated numbers with std::from_chars, the replacement of cin >> int / double:
+ *
+ * FileReader input{0};
+ * NumberReader numbers{input};
+ * int num{};
+ * if (!numbers.read(num))
+ *     std::cerr << numbers.error() << std::endl;
+ *
+ * No locale, a token is a number only if all of it is ("12abc" is an error, not 12).
+ * A leading '+' is accepted like operator>> does.
+ * After an error the bad token is skipped and reading can go on, there is no fail state to clear.
+ */
+class NumberReader {
+private:
+    FileReader& source;
+    std::ostream* tied{nullptr};
+    std::string_view current;
+    std::size_t cursor{0};
+    std::size_t line_number{0};
+    std::size_t token_column{0};
+    ParseError last_error;
+
+    bool next_token(std::string_view& token);
+
+    bool fail(ParseErrorKind kind, std::string_view token, std::size_t offset);
+
+public:
+    explicit NumberReader(FileReader& source) : source{source} {}
+
+    /**
+     * Like std::cin.tie(): the stream is flushed before input is read, so prompts are shown
+     */
+    void tie(std::ostream* os) { tied = os; }
+
+    template<typename T>
+    bool read(T& value);
+
+    /**
+     * The next non-whitespace character, like cin >> char
+     */
+    bool read(char& value);
+
+    const ParseError& error() const { return last_error; }
+
+    std::size_t line() const { return line_number; }
+};
+
+template<typename T>
+bool NumberReader::read(T& value) {
+    static_assert(std::is_arithmetic<T>::value, "NumberReader reads numbers");
+    std::string_view token;
+    if (!next_token(token))
+        return fail(ParseErrorKind::EndOfInput, token, 0);
+    const char* first = token.data();
+    const char* last = first + token.size();
+    if (*first == '+' && token.size() > 1 && first[1] != '-')
+        ++first;
+    T parsed{};
+    auto result = std::from_chars(first, last, parsed);
+    if (result.ec == std::errc::invalid_argument)
+        return fail(ParseErrorKind::NotANumber, token, 0);
+    if (result.ec == std::errc::result_out_of_range)
+        return fail(ParseErrorKind::OutOfRange, token, 0);
+    if (result.ptr != last)
+        return fail(ParseErrorKind::TrailingCharacters, token, static_cast<std::size_t>(result.ptr - token.data()));
+    value = parsed;
+    return true;
+}
+
+#endif //TOOLS_FAST_IO_NUMBER_READER_H
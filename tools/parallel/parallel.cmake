@@ -0,0 +1,22 @@
+# Thread splitting helper shared by the sections, header-only
+#
+# include() this file from a section CMakeLists.txt and call course_parallel(<target>).
+
+set(PARALLEL_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+if (NOT TARGET parallel)
+    find_package(Threads REQUIRED)
+
+    add_library(parallel INTERFACE)
+    target_include_directories(parallel INTERFACE ${PARALLEL_DIR})
+    target_compile_features(parallel INTERFACE cxx_std_17)
+    target_link_libraries(parallel INTERFACE Threads::Threads)
+endif ()
+
+function(course_parallel target)
+    # benchmark targets do not exist with -DCOURSE_BENCHMARKS=OFF
+    if (NOT TARGET ${target})
+        return()
+    endif ()
+    target_link_libraries(${target} PRIVATE parallel)
+endfunction()
@@ -0,0 +1,79 @@
+//
+// Created by andre on 19/10/2026.
+//
+
+#ifndef TOOLS_PARALLEL_PARALLEL_H
+#define TOOLS_PARALLEL_PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+/**
+ * Splitting a loop over [0, n) between threads, for the functions of the sections that take a threads argument:
+ *
+ * const unsigned parts = parallel::threads_for(values.size(), threads, parallel_threshold);
+ * std::vector<Partial> partials(parts);
+ * parallel::split(values.size(), parts, [&](unsigned part, std::size_t first, std::size_t last) {
+ *     partials[part] = partial(values.data() + first, last - first);
+ * });
+ */
+namespace parallel {
+    /**
+     * Number of parts for n items: threads = 0 picks 1 below threshold and the hardware threads from it on.
+     * At least 1 and never more than n
+     */
+    inline unsigned threads_for(std::size_t n, unsigned threads, std::size_t threshold) {
+        if (threads == 0)
+            threads = n < threshold ? 1 : std::max(1u, std::thread::hardware_concurrency());
+        return static_cast<unsigned>(std::min<std::size_t>(threads, std::max<std::size_t>(n, 1)));
+    }
+
+    /**
+     * f(part, first, last) on parts consecutive pieces of [0, n), one thread per piece,
+     * or directly on the calling thread for one part.
+     * Every piece but the last starts on a multiple of granularity.
+     * When no more threads can be started, the calling thread runs the pieces that did not get one
+     */
+    template<typename F>
+    void split(std::size_t n, unsigned parts, F f, std::size_t granularity = 1) {
+        if (parts <= 1) {
+            f(0u, std::size_t{0}, n);
+            return;
+        }
+        const std::size_t chunk = ((n + parts - 1) / parts + granularity - 1) / granularity * granularity;
+        const auto run = [&f, n, chunk](unsigned part) {
+            const std::size_t first = std::min(n, part * chunk);
+            f(part, first, std::min(n, first + chunk));
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(parts);
+        // joins the started threads on every way out, an exception included
+        struct Joiner {
+            std::vector<std::thread>& threads;
+
+            ~Joiner() {
+                for (auto& thread: threads)
+                    thread.join();
+            }
+        } joiner{workers};
+
+        unsigned part{0};
+        try {
+            for (; part < parts; part++)
+                workers.emplace_back(run, part);
+        } catch (const std::system_error&) {
+            // out of threads, the loop below runs the rest
+        } catch (const std::bad_alloc&) {
+            // same for the memory of a new thread
+        }
+        for (; part < parts; part++)
+            run(part);
+    }
+}
+
+#endif //TOOLS_PARALLEL_PARALLEL_H